@@ -22,9 +22,11 @@
 #include "best_practices/best_practices_error_enums.h"
 #include "core_checks/shader_cc_validation.h"
 #include "sync/sync_utils.h"
+#include "external/xxhash.h"
 
 #include <string>
 #include <bitset>
+#include <limits>
 #include <memory>
 
 struct VendorSpecificInfo {
@@ -855,6 +857,7 @@ void BestPractices::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memo
             memory_free_events_.push_back(event);
         }
     }
+    InvalidateIndexBufferScans(memory);
 
     ValidationStateTracker::PreCallRecordFreeMemory(device, memory, pAllocator);
 }
@@ -3376,53 +3379,13 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     if (ib_mem && last_bound.IsUsing()) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + ib_mem_offset + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
-            }
 
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
-            }
-        }
+        const IndexBufferScan scan =
+            GetIndexBufferScan(ib_mem_state.mem(), scan_begin, indexCount, ib_type, primitive_restart_enable);
+        const uint32_t min_index = scan.min_index;
+        const uint32_t max_index = scan.max_index;
+        const uint32_t vertex_shade_count = scan.vertex_shade_count;
+        const uint32_t vertex_reference_count = scan.vertex_reference_count;
 
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
@@ -3440,41 +3403,6 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
-
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
         float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
         // low hit rate (high miss rate) implies the order of indices in the draw call may be possible to improve
@@ -5405,31 +5333,156 @@ bool BestPractices::PreCallValidateCreateFence(VkDevice device, const VkFenceCre
     return skip;
 }
 
-void BestPractices::PostTransformLRUCacheModel::resize(size_t size) { _entries.resize(size); }
-
 bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
-    // look for a cache hit
-    auto hit = std::find_if(_entries.begin(), _entries.end(), [value](const CacheEntry& entry) { return entry.value == value; });
-    if (hit != _entries.end()) {
+    // look for a cache hit, the loop has no early exit so it can be vectorized
+    uint32_t hit_mask = 0;
+    for (uint32_t i = 0; i < kCacheSize; ++i) {
+        hit_mask |= static_cast<uint32_t>(values_[i] == value) << i;
+    }
+    if (hit_mask != 0) {
         // mark the cache hit as being most recently used
-        hit->age = iteration++;
+        ages_[LeastSignificantBit(hit_mask)] = iteration++;
         return true;
     }
 
     // if there's no cache hit, we need to model the entry being inserted into the cache
-    CacheEntry new_entry = {value, iteration};
-    if (iteration < static_cast<uint32_t>(std::distance(_entries.begin(), _entries.end()))) {
-        // if there is still space left in the cache, use the next available slot
-        *(_entries.begin() + iteration) = new_entry;
-    } else {
+    uint32_t slot = iteration;
+    if (iteration >= kCacheSize) {
         // otherwise replace the least recently used cache entry
-        auto lru = std::min_element(_entries.begin(), hit, [](const CacheEntry& a, const CacheEntry& b) { return a.age < b.age; });
-        *lru = new_entry;
+        uint32_t lru_age = ~0u;
+        for (uint32_t i = 0; i < kCacheSize; ++i) {
+            lru_age = std::min(lru_age, ages_[i]);
+        }
+        uint32_t lru_mask = 0;
+        for (uint32_t i = 0; i < kCacheSize; ++i) {
+            lru_mask |= static_cast<uint32_t>(ages_[i] == lru_age) << i;
+        }
+        slot = LeastSignificantBit(lru_mask);
     }
+    // if there is still space left in the cache, use the next available slot
+    values_[slot] = value;
+    ages_[slot] = iteration;
     iteration++;
     return false;
 }
 
+template <typename IndexType>
+BestPractices::IndexBufferScan BestPractices::ScanIndexBuffer(const IndexType* indices, uint32_t index_count,
+                                                              bool primitive_restart_enable) {
+    IndexBufferScan scan;
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    // This is kept as a separate pass over the native index type so it gets vectorized.
+    IndexType min_index = std::numeric_limits<IndexType>::max();
+    IndexType max_index = 0;
+    for (uint32_t i = 0; i < index_count; ++i) {
+        min_index = std::min(min_index, indices[i]);
+        max_index = std::max(max_index, indices[i]);
+    }
+    if (index_count == 0) return scan;
+    scan.min_index = min_index;
+    scan.max_index = max_index;
+
+    // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
+    // for the given index buffer
+    const IndexType primitive_restart_value = std::numeric_limits<IndexType>::max();
+    PostTransformLRUCacheModel post_transform_cache;
+    for (uint32_t i = 0; i < index_count; ++i) {
+        const IndexType scan_index = indices[i];
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            const bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) scan.vertex_shade_count++;
+        }
+    }
+
+    // The reference count is only needed if the index range is small enough to not already be reported as sparse
+    if (scan.max_index == scan.min_index || scan.max_index - scan.min_index >= index_count) return scan;
+
+    // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
+    const size_t refs_per_bucket = 64;
+    std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
+
+    const uint32_t n_indices = scan.max_index - scan.min_index + 1;
+    const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
+                               ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
+
+    // there needs to be at least one bitset to store a set of indices smaller than n_buckets
+    vertex_reference_buckets.resize(std::max(1u, n_buckets));
+
+    // To avoid using too much memory, we run over the indices again.
+    // Knowing the size from the last scan allows us to record index usage with bitsets
+    for (uint32_t i = 0; i < index_count; ++i) {
+        // keep track of the set of all indices used to reference vertices in the draw call
+        size_t index_offset = indices[i] - scan.min_index;
+        size_t bitset_bucket_index = index_offset / refs_per_bucket;
+        uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
+        vertex_reference_buckets[bitset_bucket_index] |= used_indices;
+    }
+
+    for (const auto& bitset : vertex_reference_buckets) {
+        scan.vertex_reference_count += static_cast<uint32_t>(bitset.count());
+    }
+
+    return scan;
+}
+
+BestPractices::IndexBufferScan BestPractices::GetIndexBufferScan(VkDeviceMemory memory, const uint8_t* scan_begin,
+                                                                 uint32_t index_count, VkIndexType index_type,
+                                                                 bool primitive_restart_enable) const {
+    const size_t scan_size = static_cast<size_t>(index_count) * GetIndexAlignment(index_type);
+    const uint64_t content_hash = XXH3_64bits(scan_begin, scan_size);
+    const IndexBufferScanKey key{scan_begin, index_count, index_type, primitive_restart_enable};
+
+    {
+        ReadLockGuard guard{index_buffer_scans_lock_};
+        const auto it = index_buffer_scans_.find(key);
+        if (it != index_buffer_scans_.end() && it->second.memory == memory && it->second.content_hash == content_hash) {
+            return it->second.scan;
+        }
+    }
+
+    IndexBufferScan scan;
+    if (index_type == VK_INDEX_TYPE_UINT8_EXT) {
+        scan = ScanIndexBuffer(reinterpret_cast<const uint8_t*>(scan_begin), index_count, primitive_restart_enable);
+    } else if (index_type == VK_INDEX_TYPE_UINT16) {
+        scan = ScanIndexBuffer(reinterpret_cast<const uint16_t*>(scan_begin), index_count, primitive_restart_enable);
+    } else {
+        scan = ScanIndexBuffer(reinterpret_cast<const uint32_t*>(scan_begin), index_count, primitive_restart_enable);
+    }
+
+    WriteLockGuard guard{index_buffer_scans_lock_};
+    if (index_buffer_scans_.size() >= kMaxIndexBufferScans) {
+        index_buffer_scans_.clear();
+    }
+    index_buffer_scans_.insert_or_assign(key, IndexBufferScanEntry{memory, content_hash, scan});
+    return scan;
+}
+
+void BestPractices::InvalidateIndexBufferScans(VkDeviceMemory memory) {
+    WriteLockGuard guard{index_buffer_scans_lock_};
+    for (auto it = index_buffer_scans_.begin(); it != index_buffer_scans_.end();) {
+        if (it->second.memory == memory) {
+            it = index_buffer_scans_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void BestPractices::PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) {
+    InvalidateIndexBufferScans(mem);
+    ValidationStateTracker::PreCallRecordUnmapMemory(device, mem);
+}
+
+void BestPractices::PreCallRecordUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) {
+    InvalidateIndexBufferScans(pMemoryUnmapInfo->memory);
+    ValidationStateTracker::PreCallRecordUnmapMemory2KHR(device, pMemoryUnmapInfo);
+}
+
 bool BestPractices::PreCallValidateAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                        VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) const {
     auto swapchain_data = Get<SWAPCHAIN_NODE>(swapchain);
@@ -23,6 +23,8 @@
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "utils/hash_util.h"
+#include <array>
 #include <string>
 #include <chrono>
 
@@ -443,6 +445,8 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                VkCommandBuffer* pCommandBuffers) const override;
     void PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) override;
+    void PreCallRecordUnmapMemory(VkDevice device, VkDeviceMemory mem) override;
+    void PreCallRecordUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) override;
     bool PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) const override;
     bool ValidateMultisampledBlendingArm(uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos) const;
 
@@ -970,26 +974,69 @@ class BestPractices : public ValidationStateTracker {
                                                                 CreateShaderModuleStates* csm_states) const final;
 
   private:
-    // CacheEntry and PostTransformLRUCacheModel are used on the stack
-    struct CacheEntry {
-        uint32_t value;
-        uint32_t age;
-    };
-
+    // PostTransformLRUCacheModel is used on the stack
     class PostTransformLRUCacheModel {
       public:
-        typedef std::vector<CacheEntry>::iterator cache_iterator;
-
-        void resize(size_t size);
+        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+        // target architecture.
+        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+        static constexpr uint32_t kCacheSize = 32;
 
         // Returns true if there was a cache hit - also models LRU behavior which will effect subsequent calls.
         bool query_cache(uint32_t value);
 
       private:
-        std::vector<CacheEntry> _entries = {};
+        // Values and ages are stored as separate fixed size arrays so the compiler can vectorize the searches
+        std::array<uint32_t, kCacheSize> values_ = {};
+        std::array<uint32_t, kCacheSize> ages_ = {};
         uint32_t iteration = 0;
     };
 
+    // Result of scanning the index buffer range of an indexed draw call
+    struct IndexBufferScan {
+        uint32_t min_index = ~0u;
+        uint32_t max_index = 0u;
+        uint32_t vertex_shade_count = 0;
+        // only computed if the index range is not already reported as sparse
+        uint32_t vertex_reference_count = 0;
+    };
+
+    // Index buffer scans are memoized, as the same static index buffer is typically drawn many times per frame
+    struct IndexBufferScanKey {
+        const void* data;
+        uint32_t index_count;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+
+        bool operator==(const IndexBufferScanKey& rhs) const {
+            return data == rhs.data && index_count == rhs.index_count && index_type == rhs.index_type &&
+                   primitive_restart_enable == rhs.primitive_restart_enable;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << data << index_count << index_type << primitive_restart_enable;
+            return hc.Value();
+        }
+    };
+
+    struct IndexBufferScanEntry {
+        VkDeviceMemory memory;
+        // Host writes to mapped memory are not visible to the layer, so the content hash decides if the entry is still valid
+        uint64_t content_hash;
+        IndexBufferScan scan;
+    };
+
+    // Upper bound on memoized scans, the cache is simply flushed when reached
+    static constexpr size_t kMaxIndexBufferScans = 1024;
+
+    template <typename IndexType>
+    static IndexBufferScan ScanIndexBuffer(const IndexType* indices, uint32_t index_count, bool primitive_restart_enable);
+    IndexBufferScan GetIndexBufferScan(VkDeviceMemory memory, const uint8_t* scan_begin, uint32_t index_count,
+                                       VkIndexType index_type, bool primitive_restart_enable) const;
+    void InvalidateIndexBufferScans(VkDeviceMemory memory);
+
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const;
 
@@ -1080,4 +1127,9 @@ class BestPractices : public ValidationStateTracker {
 
     vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
     mutable std::shared_mutex pipeline_lock_;
+
+    // Arm tracked
+    mutable vvl::unordered_map<IndexBufferScanKey, IndexBufferScanEntry, hash_util::HasHashMember<IndexBufferScanKey>>
+        index_buffer_scans_;
+    mutable std::shared_mutex index_buffer_scans_lock_;
 };
@@ -178,6 +178,32 @@ RangeEncoder::RangeEncoder(const VkImageSubresourceRange& full_range, const Aspe
     PopulateFunctionPointers();
 }
 
+IndexRange RangeEncoder::ContiguousRange(const VkImageSubresourceRange& range) const {
+    assert(InRange(range));
+    const bool all_layers = (range.baseArrayLayer == 0) && (range.layerCount == limits_.arrayLayer);
+    if (!all_layers && (range.levelCount != 1)) {
+        // Each mip level is a separate run of array layers
+        return IndexRange();
+    }
+
+    const uint32_t aspect_index = LowerBoundFromMask(range.aspectMask);
+    const IndexType begin = aspect_base_[aspect_index] + range.baseMipLevel * mip_size_ + range.baseArrayLayer;
+    IndexType end = begin + (all_layers ? range.levelCount * mip_size_ : range.layerCount);
+
+    // Further aspects only extend the range if it spans the whole of each of them and they are adjacent in the encoding
+    const bool all_mips = (range.baseMipLevel == 0) && (range.levelCount == limits_.mipLevel);
+    uint32_t last_aspect_index = aspect_index;
+    for (uint32_t next = LowerBoundFromMask(range.aspectMask, aspect_index + 1); next < limits_.aspect_index;
+         next = LowerBoundFromMask(range.aspectMask, next + 1)) {
+        if (!all_layers || !all_mips || (next != last_aspect_index + 1)) {
+            return IndexRange();
+        }
+        end += aspect_size_;
+        last_aspect_index = next;
+    }
+    return IndexRange(begin, end);
+}
+
 #ifndef NDEBUG
 static bool IsValid(const RangeEncoder& encoder, const VkImageSubresourceRange& bounds) {
     const auto& limits = encoder.Limits();
@@ -468,12 +494,11 @@ void ImageRangeGenerator::SetInitialPosOneAspect(uint32_t layer, uint32_t aspect
     if (subres_range_.levelCount == encoder_->Limits().mipLevel) {
         span = encoder_->GetAspectSize(aspect_index);
     } else {
-        // Add up the mip sizes...
+        // The idealized layouts are packed back to back in mip major order, so the span of the selected mips runs from the
+        // offset of the first to the end of the last without summing the sizes in between.
         // Assumes subres_info is pointing to index(baseMipLevel, aspect_index)
-        // Assumes mip major order...
-        for (uint32_t level = 0; level < subres_range_.levelCount; level++) {
-            span += subres_info_[level].layout.size;
-        }
+        const auto& last_layout = subres_info_[subres_range_.levelCount - 1].layout;
+        span = last_layout.offset + last_layout.size - subres_layout.offset;
     }
     incr_mip_ = subres_range_.levelCount;
     incr_state_.Set(1, 1, base, span, span, span);
@@ -107,6 +107,10 @@ class RangeEncoder {
                (range.aspectMask & limits_.aspectMask);
     }
 
+    // Returns the index range covered by range when it is contiguous in index space (a single mip level, all array layers of
+    // some mip levels, or whole adjacent aspects), otherwise an empty range.  The range must be InRange.
+    IndexRange ContiguousRange(const VkImageSubresourceRange& range) const;
+
     inline IndexType Encode(const Subresource& pos) const { return (this->*(encode_function_))(pos); }
     inline IndexType Encode(const VkImageSubresource& subres) const { return Encode(Subresource(*this, subres)); }
 
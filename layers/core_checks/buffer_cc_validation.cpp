@@ -476,11 +476,14 @@ bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkB
 
 // Validates the buffer is allowed to be protected
 bool CoreChecks::ValidateProtectedBuffer(const CMD_BUFFER_STATE &cb_state, const BUFFER_STATE &buffer_state, const char *cmd_name,
-                                         const char *vuid, const char *more_message) const {
+                                         const char *vuid, const char *more_message, bool *failed) const {
     bool skip = false;
 
     // if driver supports protectedNoFault the operation is valid, just has undefined values
     if ((!phys_dev_props_core11.protectedNoFault) && (cb_state.unprotected == true) && (buffer_state.unprotected == false)) {
+        if (failed) {
+            *failed = true;
+        }
         const LogObjectList objlist(cb_state.Handle(), buffer_state.Handle());
         skip |= LogError(objlist, vuid, "%s: command buffer %s is unprotected while buffer %s is a protected buffer.%s", cmd_name,
                          report_data->FormatHandle(cb_state.Handle()).c_str(),
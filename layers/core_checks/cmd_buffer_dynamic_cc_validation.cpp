@@ -25,8 +25,9 @@
 
 // Check object status for selected flag state
 bool CoreChecks::ValidateCBDynamicStatus(const CMD_BUFFER_STATE &cb_state, CBDynamicStatus status, CMD_TYPE cmd_type,
-                                         const char *msg_code) const {
+                                         const char *msg_code, bool *failed) const {
     if (!(cb_state.status[status])) {
+        *failed = true;
         return LogError(cb_state.commandBuffer(), msg_code, "%s: %s state not set for this command buffer.",
                         CommandTypeString(cmd_type), DynamicStateToString(status));
     }
@@ -34,85 +35,92 @@ bool CoreChecks::ValidateCBDynamicStatus(const CMD_BUFFER_STATE &cb_state, CBDyn
 }
 
 bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, const PIPELINE_STATE &pipeline,
-                                          CMD_TYPE cmd_type) const {
+                                          CMD_TYPE cmd_type, bool *failed) const {
     bool skip = false;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(cmd_type);
 
     // Check all state with no additional requirements
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PATCH_CONTROL_POINTS_EXT_SET, cmd_type, vuid.patch_control_points_04875);
-    skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_RASTERIZER_DISCARD_ENABLE_SET, cmd_type, vuid.rasterizer_discard_enable_04876);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BIAS_ENABLE_SET, cmd_type, vuid.depth_bias_enable_04877);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LOGIC_OP_EXT_SET, cmd_type, vuid.logic_op_04878);
-    skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PRIMITIVE_RESTART_ENABLE_SET, cmd_type, vuid.primitive_restart_enable_04879);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PATCH_CONTROL_POINTS_EXT_SET, cmd_type, vuid.patch_control_points_04875,
+                                    failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_RASTERIZER_DISCARD_ENABLE_SET, cmd_type,
+                                    vuid.rasterizer_discard_enable_04876, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BIAS_ENABLE_SET, cmd_type, vuid.depth_bias_enable_04877, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LOGIC_OP_EXT_SET, cmd_type, vuid.logic_op_04878, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PRIMITIVE_RESTART_ENABLE_SET, cmd_type,
+                                    vuid.primitive_restart_enable_04879, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET, cmd_type,
-                                    vuid.vertex_input_binding_stride_04884);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VERTEX_INPUT_EXT_SET, cmd_type, vuid.vertex_input_04914);
-    skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET, cmd_type, vuid.dynamic_color_write_enable_07749);
+                                    vuid.vertex_input_binding_stride_04884, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VERTEX_INPUT_EXT_SET, cmd_type, vuid.vertex_input_04914, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET, cmd_type,
+                                    vuid.dynamic_color_write_enable_07749, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_TESSELLATION_DOMAIN_ORIGIN_EXT_SET, cmd_type,
-                                    vuid.dynamic_tessellation_domain_origin_07619);
-    skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_CLAMP_ENABLE_EXT_SET, cmd_type, vuid.dynamic_depth_clamp_enable_07620);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_POLYGON_MODE_EXT_SET, cmd_type, vuid.dynamic_polygon_mode_07621);
+                                    vuid.dynamic_tessellation_domain_origin_07619, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_CLAMP_ENABLE_EXT_SET, cmd_type,
+                                    vuid.dynamic_depth_clamp_enable_07620, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_POLYGON_MODE_EXT_SET, cmd_type, vuid.dynamic_polygon_mode_07621, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET, cmd_type,
-                                    vuid.dynamic_rasterization_samples_07622);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SAMPLE_MASK_EXT_SET, cmd_type, vuid.dynamic_sample_mask_07623);
+                                    vuid.dynamic_rasterization_samples_07622, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SAMPLE_MASK_EXT_SET, cmd_type, vuid.dynamic_sample_mask_07623, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_ALPHA_TO_COVERAGE_ENABLE_EXT_SET, cmd_type,
-                                    vuid.dynamic_alpha_to_coverage_enable_07624);
+                                    vuid.dynamic_alpha_to_coverage_enable_07624, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_ALPHA_TO_ONE_ENABLE_EXT_SET, cmd_type,
+                                    vuid.dynamic_alpha_to_one_enable_07625, failed);
     skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_ALPHA_TO_ONE_ENABLE_EXT_SET, cmd_type, vuid.dynamic_alpha_to_one_enable_07625);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LOGIC_OP_ENABLE_EXT_SET, cmd_type, vuid.dynamic_logic_op_enable_07626);
+        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LOGIC_OP_ENABLE_EXT_SET, cmd_type, vuid.dynamic_logic_op_enable_07626, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_RASTERIZATION_STREAM_EXT_SET, cmd_type,
-                                    vuid.dynamic_rasterization_stream_07630);
+                                    vuid.dynamic_rasterization_stream_07630, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_CONSERVATIVE_RASTERIZATION_MODE_EXT_SET, cmd_type,
-                                    vuid.dynamic_conservative_rasterization_mode_07631);
+                                    vuid.dynamic_conservative_rasterization_mode_07631, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT_SET, cmd_type,
-                                    vuid.dynamic_extra_primitive_overestimation_size_07632);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_CLIP_ENABLE_EXT_SET, cmd_type, vuid.dynamic_depth_clip_enable_07633);
+                                    vuid.dynamic_extra_primitive_overestimation_size_07632, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_CLIP_ENABLE_EXT_SET, cmd_type, vuid.dynamic_depth_clip_enable_07633,
+                                    failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SAMPLE_LOCATIONS_ENABLE_EXT_SET, cmd_type,
-                                    vuid.dynamic_sample_locations_enable_07634);
+                                    vuid.dynamic_sample_locations_enable_07634, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PROVOKING_VERTEX_MODE_EXT_SET, cmd_type,
-                                    vuid.dynamic_provoking_vertex_mode_07636);
+                                    vuid.dynamic_provoking_vertex_mode_07636, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_RASTERIZATION_MODE_EXT_SET, cmd_type,
-                                    vuid.dynamic_line_rasterization_mode_07637);
-    skip |=
-        ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_STIPPLE_ENABLE_EXT_SET, cmd_type, vuid.dynamic_line_stipple_enable_07638);
+                                    vuid.dynamic_line_rasterization_mode_07637, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_STIPPLE_ENABLE_EXT_SET, cmd_type,
+                                    vuid.dynamic_line_stipple_enable_07638, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT_SET, cmd_type,
-                                    vuid.dynamic_depth_clip_negative_one_to_one_07639);
+                                    vuid.dynamic_depth_clip_negative_one_to_one_07639, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VIEWPORT_W_SCALING_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_viewport_w_scaling_enable_07640);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VIEWPORT_SWIZZLE_NV_SET, cmd_type, vuid.dynamic_viewport_swizzle_07641);
+                                    vuid.dynamic_viewport_w_scaling_enable_07640, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_VIEWPORT_SWIZZLE_NV_SET, cmd_type, vuid.dynamic_viewport_swizzle_07641,
+                                    failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_TO_COLOR_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_to_color_enable_07642);
+                                    vuid.dynamic_coverage_to_color_enable_07642, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_TO_COLOR_LOCATION_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_to_color_location_07643);
+                                    vuid.dynamic_coverage_to_color_location_07643, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_MODULATION_MODE_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_modulation_mode_07644);
+                                    vuid.dynamic_coverage_modulation_mode_07644, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_MODULATION_TABLE_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_modulation_table_enable_07645);
+                                    vuid.dynamic_coverage_modulation_table_enable_07645, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_MODULATION_TABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_modulation_table_07646);
+                                    vuid.dynamic_coverage_modulation_table_07646, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SHADING_RATE_IMAGE_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_shading_rate_image_enable_07649);
+                                    vuid.dynamic_shading_rate_image_enable_07649, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_representative_fragment_test_enable_07648);
+                                    vuid.dynamic_representative_fragment_test_enable_07648, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_COVERAGE_REDUCTION_MODE_NV_SET, cmd_type,
-                                    vuid.dynamic_coverage_reduction_mode_07647);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SAMPLE_LOCATIONS_EXT_SET, cmd_type, vuid.dynamic_sample_locations_06666);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PRIMITIVE_TOPOLOGY_SET, cmd_type, vuid.dynamic_primitive_topology_07842);
+                                    vuid.dynamic_coverage_reduction_mode_07647, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_SAMPLE_LOCATIONS_EXT_SET, cmd_type, vuid.dynamic_sample_locations_06666,
+                                    failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_PRIMITIVE_TOPOLOGY_SET, cmd_type, vuid.dynamic_primitive_topology_07842,
+                                    failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DISCARD_RECTANGLE_ENABLE_EXT_SET, cmd_type,
-                                    vuid.dynamic_discard_rectangle_enable_07880);
+                                    vuid.dynamic_discard_rectangle_enable_07880, failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DISCARD_RECTANGLE_MODE_EXT_SET, cmd_type,
-                                    vuid.dynamic_discard_rectangle_mode_07881);
-    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_EXCLUSIVE_SCISSOR_NV_SET, cmd_type, vuid.dynamic_exclusive_scissor_07878);
+                                    vuid.dynamic_discard_rectangle_mode_07881, failed);
+    skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_EXCLUSIVE_SCISSOR_NV_SET, cmd_type, vuid.dynamic_exclusive_scissor_07878,
+                                    failed);
     skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_EXCLUSIVE_SCISSOR_ENABLE_NV_SET, cmd_type,
-                                    vuid.dynamic_exclusive_scissor_enable_07879);
+                                    vuid.dynamic_exclusive_scissor_enable_07879, failed);
 
     const auto rp_state = pipeline.RasterizationState();
     if (rp_state && (rp_state->depthBiasEnable == VK_TRUE)) {
-        skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BIAS_SET, cmd_type, vuid.dynamic_depth_bias_07834);
+        skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BIAS_SET, cmd_type, vuid.dynamic_depth_bias_07834, failed);
     }
 
     // Any line topology
@@ -120,39 +128,42 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
         pipeline.topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP ||
         pipeline.topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY ||
         pipeline.topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY) {
-        skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_WIDTH_SET, cmd_type, vuid.dynamic_line_width_07833);
+        skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_WIDTH_SET, cmd_type, vuid.dynamic_line_width_07833, failed);
         const auto *line_state = LvlFindInChain<VkPipelineRasterizationLineStateCreateInfoEXT>(rp_state);
         if (line_state && line_state->stippledLineEnable) {
-            skip |=
-                ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_STIPPLE_EXT_SET, cmd_type, vuid.dynamic_line_stipple_ext_07849);
+            skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_LINE_STIPPLE_EXT_SET, cmd_type,
+                                            vuid.dynamic_line_stipple_ext_07849, failed);
         }
     }
 
     if (pipeline.BlendConstantsEnabled()) {
-        skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_BLEND_CONSTANTS_SET, cmd_type, vuid.dynamic_blend_constants_07835);
+        skip |=
+            ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_BLEND_CONSTANTS_SET, cmd_type, vuid.dynamic_blend_constants_07835, failed);
     }
 
     const auto ds_state = pipeline.DepthStencilState();
     if (ds_state) {
         if (ds_state->depthBoundsTestEnable == VK_TRUE) {
-            skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BOUNDS_SET, cmd_type, vuid.dynamic_depth_bounds_07836);
+            skip |=
+                ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_DEPTH_BOUNDS_SET, cmd_type, vuid.dynamic_depth_bounds_07836, failed);
         }
         if (ds_state->stencilTestEnable == VK_TRUE) {
             skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_STENCIL_COMPARE_MASK_SET, cmd_type,
-                                            vuid.dynamic_stencil_compare_mask_07837);
+                                            vuid.dynamic_stencil_compare_mask_07837, failed);
             skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_STENCIL_WRITE_MASK_SET, cmd_type,
-                                            vuid.dynamic_stencil_write_mask_07838);
-            skip |=
-                ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_STENCIL_REFERENCE_SET, cmd_type, vuid.dynamic_stencil_reference_07839);
+                                            vuid.dynamic_stencil_write_mask_07838, failed);
+            skip |= ValidateCBDynamicStatus(cb_state, CB_DYNAMIC_STENCIL_REFERENCE_SET, cmd_type,
+                                            vuid.dynamic_stencil_reference_07839, failed);
         }
     }
 
     // vkCmdSetDiscardRectangleEXT needs to be set on each rectangle
     const auto *discard_rectangle_state = LvlFindInChain<VkPipelineDiscardRectangleStateCreateInfoEXT>(pipeline.PNext());
-    if (discard_rectangle_state && pipeline.IsDynamic(VK_DYNAMIC_STATE_DISCARD_RECTANGLE_EXT)) {
+    if (discard_rectangle_state && pipeline.IsDynamic(CB_DYNAMIC_DISCARD_RECTANGLE_EXT_SET)) {
         for (uint32_t i = 0; i < discard_rectangle_state->discardRectangleCount; i++) {
             if (!cb_state.dynamic_state_value.discard_rectangles.test(i)) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.dynamic_discard_rectangle_07751,
                                  "%s: vkCmdSetDiscardRectangleEXT was not set for discard rectangle index %" PRIu32
                                  " for this command buffer.",
@@ -164,33 +175,37 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
 
     // must set the state for all active color attachments in the current subpass
     for (const uint32_t &color_index : cb_state.active_color_attachments_index) {
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT) &&
+        if (pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_ENABLE_EXT_SET) &&
             !cb_state.dynamic_state_value.color_blend_enable_attachments.test(color_index)) {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |= LogError(objlist, vuid.dynamic_color_blend_enable_07476,
                              "%s: vkCmdSetColorBlendEnableEXT was not set for color attachment index %" PRIu32
                              " for this command buffer.",
                              CommandTypeString(cmd_type), color_index);
         }
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT) &&
+        if (pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_EQUATION_EXT_SET) &&
             !cb_state.dynamic_state_value.color_blend_equation_attachments.test(color_index)) {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |= LogError(objlist, vuid.dynamic_color_blend_equation_07477,
                              "%s: vkCmdSetColorBlendEquationEXT was not set for color attachment index %" PRIu32
                              " for this command buffer.",
                              CommandTypeString(cmd_type), color_index);
         }
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT) &&
+        if (pipeline.IsDynamic(CB_DYNAMIC_COLOR_WRITE_MASK_EXT_SET) &&
             !cb_state.dynamic_state_value.color_write_mask_attachments.test(color_index)) {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |= LogError(objlist, vuid.dynamic_color_write_mask_07478,
                              "%s: vkCmdSetColorWriteMaskEXT was not set for color attachment index %" PRIu32
                              " for this command buffer.",
                              CommandTypeString(cmd_type), color_index);
         }
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ADVANCED_EXT) &&
+        if (pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_ADVANCED_EXT_SET) &&
             !cb_state.dynamic_state_value.color_blend_advanced_attachments.test(color_index)) {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |= LogError(objlist, vuid.dynamic_color_blend_advanced_07479,
                              "%s: vkCmdSetColorBlendAdvancedEXT was not set for color attachment index %" PRIu32
                              " for this command buffer.",
@@ -205,6 +220,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
 
     if (invalid_status.any()) {
         const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+        *failed = true;
         skip |= LogError(objlist, vuid.dynamic_state_setting_commands_02859,
                          "%s: %s doesn't set up %s, but it calls the related dynamic state setting commands",
                          CommandTypeString(cmd_type), report_data->FormatHandle(pipeline.pipeline()).c_str(),
@@ -213,11 +229,11 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
 
     // If Viewport or scissors are dynamic, verify that dynamic count matches PSO count.
     // Skip check if rasterization is disabled, if there is no viewport, or if viewport/scissors are being inherited.
-    const bool dyn_viewport = pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT);
+    const bool dyn_viewport = pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_SET);
     const auto *viewport_state = pipeline.ViewportState();
     if ((!rp_state || (rp_state->rasterizerDiscardEnable == VK_FALSE)) && viewport_state &&
         (cb_state.inheritedViewportDepths.size() == 0)) {
-        const bool dyn_scissor = pipeline.IsDynamic(VK_DYNAMIC_STATE_SCISSOR);
+        const bool dyn_scissor = pipeline.IsDynamic(CB_DYNAMIC_SCISSOR_SET);
 
         // NB (akeley98): Current validation layers do not detect the error where vkCmdSetViewport (or scissor) was called, but
         // the dynamic state set is overwritten by binding a graphics pipeline with static viewport (scissor) state.
@@ -228,6 +244,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
             const auto missing_viewport_mask = ~cb_state.viewportMask & required_viewports_mask;
             if (missing_viewport_mask) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |=
                     LogError(objlist, vuid.dynamic_viewport_07831,
                              "%s: Dynamic viewport(s) (0x%x) are used by pipeline state object, but were not provided via calls "
@@ -241,6 +258,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
             const auto missing_scissor_mask = ~cb_state.scissorMask & required_scissor_mask;
             if (missing_scissor_mask) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.dynamic_scissor_07832,
                                  "%s: Dynamic scissor(s) (0x%x) are used by pipeline state object, but were not provided via calls "
                                  "to vkCmdSetScissor().",
@@ -248,14 +266,15 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
             }
         }
 
-        const bool dyn_viewport_count = pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT);
-        const bool dyn_scissor_count = pipeline.IsDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT);
+        const bool dyn_viewport_count = pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_WITH_COUNT_SET);
+        const bool dyn_scissor_count = pipeline.IsDynamic(CB_DYNAMIC_SCISSOR_WITH_COUNT_SET);
 
         if (dyn_viewport_count && !dyn_scissor_count) {
             const auto required_viewport_mask = (1 << viewport_state->scissorCount) - 1;
             const auto missing_viewport_mask = ~cb_state.viewportWithCountMask & required_viewport_mask;
             if (missing_viewport_mask) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.viewport_count_03417,
                                  "%s: Dynamic viewport with count 0x%x are used by pipeline state object, but were not provided "
                                  "via calls to vkCmdSetViewportWithCountEXT().",
@@ -268,6 +287,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
             const auto missing_scissor_mask = ~cb_state.scissorWithCountMask & required_scissor_mask;
             if (missing_scissor_mask) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.scissor_count_03418,
                                  "%s: Dynamic scissor with count 0x%x are used by pipeline state object, but were not provided via "
                                  "calls to vkCmdSetScissorWithCountEXT().",
@@ -278,6 +298,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
         if (dyn_scissor_count && dyn_viewport_count) {
             if (cb_state.viewportWithCountMask != cb_state.scissorWithCountMask) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.viewport_scissor_count_03419,
                                  "%s: Dynamic viewport and scissor with count 0x%x are used by pipeline state object, but were not "
                                  "provided via matching calls to "
@@ -293,6 +314,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
         const uint32_t max_inherited = uint32_t(cb_state.inheritedViewportDepths.size());
         if (viewport_count > max_inherited) {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |=
                 LogError(objlist, vuid.dynamic_state_inherited_07850,
                          "%s: Pipeline requires more viewports (%" PRIu32 ".) than inherited (viewportDepthCount = %" PRIu32 ".).",
@@ -300,12 +322,13 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
         }
     }
 
-    if (pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT) && cb_state.status[CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET]) {
+    if (pipeline.IsDynamic(CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET) && cb_state.status[CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET]) {
         const auto color_blend_state = cb_state.GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS)->ColorBlendState();
         if (color_blend_state) {
             uint32_t blend_attachment_count = color_blend_state->attachmentCount;
             if (cb_state.dynamicColorWriteEnableAttachmentCount < blend_attachment_count) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(
                     objlist, vuid.dynamic_color_write_enable_count_07750,
                     "%s(): Currently bound pipeline was created with VkPipelineColorBlendStateCreateInfo::attachmentCount %" PRIu32
@@ -318,7 +341,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
 
     // Makes sure topology is compatible (in same topology class)
     // see vkspec.html#drawing-primitive-topology-class
-    if (pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY) &&
+    if (pipeline.IsDynamic(CB_DYNAMIC_PRIMITIVE_TOPOLOGY_SET) &&
         !phys_dev_ext_props.extended_dynamic_state3_props.dynamicPrimitiveTopologyUnrestricted) {
         bool compatible_topology = false;
         const VkPrimitiveTopology pipeline_topology = pipeline.InputAssemblyState()->topology;
@@ -382,6 +405,7 @@ bool CoreChecks::ValidateDrawDynamicState(const CMD_BUFFER_STATE &cb_state, cons
                                          ? vuid.primitive_topology_class_ds3_07500
                                          : vuid.primitive_topology_class_03420;
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+            *failed = true;
             skip |= LogError(objlist, vuid_error,
                              "%s: the last primitive topology %s state set by vkCmdSetPrimitiveTopology is "
                              "not compatible with the pipeline topology %s.",
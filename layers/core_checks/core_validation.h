@@ -353,6 +353,7 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    mutable LibraryLinkCache library_link_cache;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -390,8 +391,10 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateSemaphoresForSubmit(struct SemaphoreSubmitState& state, const VkSubmitInfo2KHR& submit, const Location& loc) const;
     bool ValidateSemaphoresForSubmit(struct SemaphoreSubmitState& state, const VkBindSparseInfo& submit, const Location& loc) const;
     bool ValidateCBDynamicStatus(const CMD_BUFFER_STATE& cb_state, CBDynamicStatus status, CMD_TYPE cmd_type,
-                                 const char* msg_code) const;
-    bool ValidateDrawDynamicState(const CMD_BUFFER_STATE& cb_state, const PIPELINE_STATE& pipeline, CMD_TYPE cmd_type) const;
+                                 const char* msg_code, bool* failed) const;
+    // The draw-time state checks also set *failed when they find a problem, whether or not its message is reported
+    bool ValidateDrawDynamicState(const CMD_BUFFER_STATE& cb_state, const PIPELINE_STATE& pipeline, CMD_TYPE cmd_type,
+                                  bool* failed) const;
     bool LogInvalidAttachmentMessage(const char* type1_string, const RENDER_PASS_STATE& rp1_state, const char* type2_string,
                                      const RENDER_PASS_STATE& rp2_state, uint32_t primary_attach, uint32_t secondary_attach,
                                      const char* msg, const char* caller, const char* error_code) const;
@@ -426,7 +429,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateUnprotectedImage(const CMD_BUFFER_STATE& cb_state, const IMAGE_STATE& image_state, const char* cmd_name,
                                   const char* vuid, const char* more_message = "") const;
     bool ValidateProtectedBuffer(const CMD_BUFFER_STATE& cb_state, const BUFFER_STATE& buffer_state, const char* cmd_name,
-                                 const char* vuid, const char* more_message = "") const;
+                                 const char* vuid, const char* more_message = "", bool* failed = nullptr) const;
     bool ValidateUnprotectedBuffer(const CMD_BUFFER_STATE& cb_state, const BUFFER_STATE& buffer_state, const char* cmd_name,
                                    const char* vuid, const char* more_message = "") const;
 
@@ -723,7 +726,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidatePipelineDynamicRenderpassDraw(const LAST_BOUND_STATE& state, const CMD_BUFFER_STATE& cb_state, CMD_TYPE cmd_type,
                                                const PIPELINE_STATE& pipeline) const;
     bool ValidatePipelineDrawtimeState(const LAST_BOUND_STATE& state, const CMD_BUFFER_STATE& cb_state, CMD_TYPE cmd_type,
-                                       const PIPELINE_STATE& pipeline) const;
+                                       const PIPELINE_STATE& pipeline, bool* failed) const;
     bool ValidateCmdBufDrawState(const CMD_BUFFER_STATE& cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) const;
     bool ValidateCmdRayQueryState(const CMD_BUFFER_STATE& cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) const;
     static bool ValidateEventStageMask(const CMD_BUFFER_STATE& cb_state, size_t eventCount, size_t firstEventIndex,
@@ -825,7 +828,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelinePortability(const PIPELINE_STATE& pipeline) const;
     bool ValidateGraphicsPipelineLibrary(const PIPELINE_STATE& pipeline) const;
     bool ValidateGraphicsPipelineShaderDynamicState(const PIPELINE_STATE& pipeline, const CMD_BUFFER_STATE& cb_state,
-                                                    const char* caller, const DrawDispatchVuid& vuid) const;
+                                                    const char* caller, const DrawDispatchVuid& vuid, bool* failed) const;
     bool ValidateGraphicsPipelineBlendEnable(const PIPELINE_STATE& pipeline) const;
     bool ValidateGraphicsPipelinePreRasterState(const PIPELINE_STATE& pipeline) const;
     bool ValidateGraphicsPipelineInputAssemblyState(const PIPELINE_STATE& pipeline) const;
@@ -878,14 +881,15 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateAtomicsTypes(const SHADER_MODULE_STATE& module_state) const;
     bool ValidateExecutionModes(const SHADER_MODULE_STATE& module_state, const SHADER_MODULE_STATE::EntryPoint& entrypoint,
                                 VkShaderStageFlagBits stage, const PIPELINE_STATE& pipeline) const;
+    // The cross-stage interface checks also set *failed when they find a problem, whether or not its message is reported
     bool ValidateViAgainstVsInputs(const PIPELINE_STATE& pipeline, const SHADER_MODULE_STATE& module_state,
-                                   const SHADER_MODULE_STATE::EntryPoint& entrypoint) const;
+                                   const SHADER_MODULE_STATE::EntryPoint& entrypoint, bool* failed) const;
     bool ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE& module_state,
                                             const SHADER_MODULE_STATE::EntryPoint& entrypoint, const PIPELINE_STATE& pipeline,
-                                            uint32_t subpass_index) const;
+                                            uint32_t subpass_index, bool* failed) const;
     bool ValidateFsOutputsAgainstDynamicRenderingRenderPass(const SHADER_MODULE_STATE& module_state,
                                                             const SHADER_MODULE_STATE::EntryPoint& entrypoint,
-                                                            const PIPELINE_STATE& pipeline) const;
+                                                            const PIPELINE_STATE& pipeline, bool* failed) const;
     bool ValidateShaderInputAttachment(const SHADER_MODULE_STATE& module_state, const PIPELINE_STATE& pipeline,
                                        const ResourceInterfaceVariable& variable) const;
     bool ValidateConservativeRasterization(const SHADER_MODULE_STATE& module_state,
@@ -906,7 +910,8 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE& producer,
                                         const SHADER_MODULE_STATE::EntryPoint& producer_entrypoint,
                                         const SHADER_MODULE_STATE& consumer,
-                                        const SHADER_MODULE_STATE::EntryPoint& consumer_entrypoint, uint32_t pipe_index) const;
+                                        const SHADER_MODULE_STATE::EntryPoint& consumer_entrypoint, uint32_t pipe_index,
+                                        bool* failed) const;
     bool ValidateVariables(const SHADER_MODULE_STATE& module_state) const;
     bool ValidateShaderDescriptorVariable(const SHADER_MODULE_STATE& module_state, VkShaderStageFlagBits stage,
                                           const PIPELINE_STATE& pipeline, const SHADER_MODULE_STATE::EntryPoint& entrypoint) const;
@@ -2511,43 +2511,71 @@ cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationSt
                                                               const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
                                                               VkDescriptorSetLayout push_layout) {
     auto const &create_info = template_state->create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
     desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
     VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
                                               ? create_info.descriptorSetLayout
                                               : push_layout;
     auto layout_obj = device_data->Get<cvdescriptorset::DescriptorSetLayout>(effective_dsl);
 
-    // Create a WriteDescriptorSet struct for each template update entry
+    // Create a WriteDescriptorSet struct for each run of template update entry elements
     for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        auto binding_count = layout_obj->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
-        auto binding_being_updated = create_info.pDescriptorUpdateEntries[i].dstBinding;
-        auto dst_array_element = create_info.pDescriptorUpdateEntries[i].dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + create_info.pDescriptorUpdateEntries[i].descriptorCount);
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
-            desc_writes.emplace_back();
-            auto &write_entry = desc_writes.back();
-
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
+        const auto &update_template_entry = create_info.pDescriptorUpdateEntries[i];
+        auto binding_being_updated = update_template_entry.dstBinding;
+        auto binding_count = layout_obj->GetDescriptorCountFromBinding(binding_being_updated);
+        auto dst_array_element = update_template_entry.dstArrayElement;
+
+        // When the application data is tightly packed, the elements going to the same binding can be a single write pointing
+        // straight at pData, instead of one write per descriptor
+        size_t element_size = 0;
+        switch (update_template_entry.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                element_size = sizeof(VkDescriptorImageInfo);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                element_size = sizeof(VkDescriptorBufferInfo);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                element_size = sizeof(VkBufferView);
+                break;
+            default:
+                break;
+        }
+        const bool packed = element_size != 0 && update_template_entry.stride == element_size;
+
+        uint32_t j = 0;
+        while (j < update_template_entry.descriptorCount) {
+            size_t offset = update_template_entry.offset + j * update_template_entry.stride;
             char *update_entry = (char *)(pData) + offset;
 
             if (dst_array_element >= binding_count) {
                 dst_array_element = 0;
                 binding_being_updated = layout_obj->GetNextValidBinding(binding_being_updated);
+                binding_count = layout_obj->GetDescriptorCountFromBinding(binding_being_updated);
+            }
+            uint32_t run = 1;
+            if (packed && binding_count > dst_array_element) {
+                run = std::min(update_template_entry.descriptorCount - j, binding_count - dst_array_element);
             }
 
+            desc_writes.emplace_back();
+            auto &write_entry = desc_writes.back();
             write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
             write_entry.pNext = NULL;
             write_entry.dstSet = descriptorSet;
             write_entry.dstBinding = binding_being_updated;
             write_entry.dstArrayElement = dst_array_element;
-            write_entry.descriptorCount = 1;
-            write_entry.descriptorType = create_info.pDescriptorUpdateEntries[i].descriptorType;
+            write_entry.descriptorCount = run;
+            write_entry.descriptorType = update_template_entry.descriptorType;
 
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
+            switch (update_template_entry.descriptorType) {
                 case VK_DESCRIPTOR_TYPE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
@@ -2568,32 +2596,41 @@ cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationSt
                     write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
                     break;
                 case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
+                    if (inline_infos.empty()) {
+                        inline_infos.resize(create_info.descriptorUpdateEntryCount);
+                    }
                     VkWriteDescriptorSetInlineUniformBlockEXT *inline_info = &inline_infos[i];
                     inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
                     inline_info->pNext = nullptr;
-                    inline_info->dataSize = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    inline_info->dataSize = update_template_entry.descriptorCount;
                     inline_info->pData = update_entry;
                     write_entry.pNext = inline_info;
                     // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlockEXT structure
                     write_entry.descriptorCount = inline_info->dataSize;
                     // skip the rest of the array, they just represent bytes in the update
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    run = update_template_entry.descriptorCount;
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
+                    if (inline_infos_khr.empty()) {
+                        inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
+                    }
                     VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
                     inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
                     inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    inline_info_khr->accelerationStructureCount = update_template_entry.descriptorCount;
                     inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
                     write_entry.pNext = inline_info_khr;
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
+                    if (inline_infos_nv.empty()) {
+                        inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
+                    }
                     VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
                     inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
                     inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    inline_info_nv->accelerationStructureCount = update_template_entry.descriptorCount;
                     inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
                     write_entry.pNext = inline_info_nv;
                     break;
@@ -2602,7 +2639,8 @@ cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationSt
                     assert(0);
                     break;
             }
-            dst_array_element++;
+            dst_array_element += run;
+            j += run;
         }
     }
 }
@@ -2827,8 +2827,28 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
     }
 
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
-        skip |= ValidateDrawDynamicState(cb_state, pipeline, cmd_type);
-        skip |= ValidatePipelineDrawtimeState(last_bound, cb_state, cmd_type, pipeline);
+        if (cb_state.activeRenderPass) {
+            if (cb_state.activeRenderPass->UsesDynamicRendering()) {
+                skip |= ValidatePipelineDynamicRenderpassDraw(last_bound, cb_state, cmd_type, pipeline);
+            } else {
+                skip |= ValidatePipelineRenderpassDraw(last_bound, cb_state, cmd_type, pipeline);
+            }
+        }
+
+        // The remaining pipeline and dynamic state checks only read state set by recorded commands, so once they find no problem
+        // they don't need to run again until another command is recorded, or the pipeline or draw command changes.
+        auto &validated = cb_state.validated_draw_state;
+        if (validated.command_count != cb_state.command_count || validated.pipeline != &pipeline ||
+            validated.cmd_type != cmd_type) {
+            bool failed = false;
+            skip |= ValidateDrawDynamicState(cb_state, pipeline, cmd_type, &failed);
+            skip |= ValidatePipelineDrawtimeState(last_bound, cb_state, cmd_type, pipeline, &failed);
+            if (!failed) {
+                validated = {cb_state.command_count, &pipeline, cmd_type};
+            } else {
+                validated.pipeline = nullptr;
+            }
+        }
 
         if (cb_state.activeRenderPass && cb_state.activeFramebuffer) {
             // Verify attachments for unprotected/protected command buffer.
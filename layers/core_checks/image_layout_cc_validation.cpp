@@ -311,8 +311,15 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
         assert(global_map);
         auto global_map_guard = global_map->ReadLock();
 
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
+        // Resubmitting a command buffer against global layouts that haven't changed since it last matched them, with nothing
+        // earlier in this submission having changed them either, gives the same result
+        const uint64_t global_version = global_map->GetVersion();
+        const bool overlay_empty = overlay_map->empty();
+        if (overlay_empty && subres_map->validated_global_version.load(std::memory_order_relaxed) == global_version) {
+            sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            continue;
+        }
+        bool layout_mismatch = false;
 
         auto pos = layout_map.begin();
         const auto end = layout_map.end();
@@ -340,6 +347,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
+                    layout_mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -364,6 +372,9 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 }
             }
         }
+        if (overlay_empty && !layout_mismatch) {
+            subres_map->validated_global_version.store(global_version, std::memory_order_relaxed);
+        }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
     }
@@ -376,7 +387,9 @@ void CoreChecks::UpdateCmdBufImageLayouts(const CMD_BUFFER_STATE *cb_state) {
         const auto *image_state = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
         auto guard = image_state->layout_range_map->WriteLock();
-        sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+        if (sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+            image_state->layout_range_map->UpdateVersion();
+        }
     }
 }
 
@@ -1050,10 +1063,14 @@ void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uint32_t bar
     // choose to perform it as part of the acquire operation.
     //
     // However, we still need to record initial layout for the "initial layout" validation
+    std::shared_ptr<const IMAGE_STATE> image_state;
     for (uint32_t i = 0; i < barrier_count; i++) {
         const auto &mem_barrier = barriers[i];
         const bool is_release_op = cb_state->IsReleaseOp(mem_barrier);
-        auto image_state = Get<IMAGE_STATE>(mem_barrier.image);
+        // Large barrier batches typically list the barriers for an image (e.g. per mip level) consecutively
+        if (!image_state || (image_state->image() != mem_barrier.image)) {
+            image_state = Get<IMAGE_STATE>(mem_barrier.image);
+        }
         if (image_state) {
             RecordTransitionImageLayout(cb_state, image_state.get(), mem_barrier, is_release_op);
         }
@@ -200,7 +200,7 @@ bool CoreChecks::ValidatePipeline(const PIPELINE_STATE &pipeline) const {
     // vkspec.html#pipelines-graphics-subsets-vertex-input
     if ((pipeline.create_info_shaders & VK_SHADER_STAGE_VERTEX_BIT) &&
         (!pipeline.IsGraphicsLibrary() || (pipeline.IsGraphicsLibrary() && pipeline.vertex_input_state))) {
-        if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        if (!pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_EXT_SET)) {
             const auto *input_state = pipeline.InputState();
             if (!input_state) {
                 const char *vuid = IsExtEnabled(device_extensions.vk_ext_vertex_input_dynamic_state)
@@ -1801,7 +1801,7 @@ bool CoreChecks::ValidateGraphicsPipelineRasterizationState(const PIPELINE_STATE
                              pipeline.create_index);
         }
 
-        if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_BIAS) && (raster_state->depthBiasClamp != 0.0) &&
+        if (!pipeline.IsDynamic(CB_DYNAMIC_DEPTH_BIAS_SET) && (raster_state->depthBiasClamp != 0.0) &&
             (!enabled_features.core.depthBiasClamp)) {
             skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-00754",
                              "vkCreateGraphicsPipelines() pCreateInfo[%" PRIu32
@@ -1856,7 +1856,7 @@ bool CoreChecks::ValidateGraphicsPipelineRasterizationState(const PIPELINE_STATE
 
                         // The extension was not created with a feature bit whichs prevents displaying the 2 variations of the VUIDs
                         if (!IsExtEnabled(device_extensions.vk_ext_depth_range_unrestricted) &&
-                            !pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_BOUNDS)) {
+                            !pipeline.IsDynamic(CB_DYNAMIC_DEPTH_BOUNDS_SET)) {
                             const float minDepthBounds = ds_state->minDepthBounds;
                             const float maxDepthBounds = ds_state->maxDepthBounds;
                             // Also VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-00755
@@ -2025,7 +2025,7 @@ bool CoreChecks::ValidateGraphicsPipelineMultisampleState(const PIPELINE_STATE &
         };
 
         const uint32_t raster_samples = SampleCountSize(multisample_state->rasterizationSamples);
-        if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT)) {
+        if (!pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET)) {
             if (!(IsExtEnabled(device_extensions.vk_amd_mixed_attachment_samples) ||
                   IsExtEnabled(device_extensions.vk_nv_framebuffer_mixed_samples) ||
                   (enabled_features.multisampled_render_to_single_sampled_features.multisampledRenderToSingleSampled))) {
@@ -2273,8 +2273,8 @@ bool CoreChecks::ValidateGraphicsPipelineMultisampleState(const PIPELINE_STATE &
 
             if (sample_location_state != nullptr) {
                 if ((sample_location_state->sampleLocationsEnable == VK_TRUE) &&
-                    (pipeline.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT) == false) &&
-                    (pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT) == false)) {
+                    (pipeline.IsDynamic(CB_DYNAMIC_SAMPLE_LOCATIONS_EXT_SET) == false) &&
+                    (pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET) == false)) {
                     const VkSampleLocationsInfoEXT sample_location_info = sample_location_state->sampleLocationsInfo;
                     skip |= ValidateSampleLocationsInfo(&sample_location_info, "vkCreateGraphicsPipelines");
                     const VkExtent2D grid_size = sample_location_info.sampleLocationGridSize;
@@ -2342,7 +2342,7 @@ bool CoreChecks::ValidateGraphicsPipelineMultisampleState(const PIPELINE_STATE &
 
             if ((subpass_desc->flags & VK_SUBPASS_DESCRIPTION_FRAGMENT_REGION_BIT_QCOM) != 0) {
                 if ((raster_samples != subpass_input_attachment_samples) &&
-                    !pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT)) {
+                    !pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET)) {
                     skip |=
                         LogError(device, "VUID-VkGraphicsPipelineCreateInfo-rasterizationSamples-04899",
                                  "vkCreateGraphicsPipelines() pCreateInfo[%" PRIu32
@@ -2429,8 +2429,8 @@ bool CoreChecks::ValidateGraphicsPipelineDepthStencilState(const PIPELINE_STATE
 bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipeline) const {
     bool skip = false;
     if (pipeline.create_info_shaders & VK_SHADER_STAGE_MESH_BIT_EXT) {
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY) ||
-            pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE)) {
+        if (pipeline.IsDynamic(CB_DYNAMIC_PRIMITIVE_TOPOLOGY_SET) ||
+            pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET)) {
             skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-07065",
                              "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                              "] pDynamicState must not contain "
@@ -2439,8 +2439,8 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
                              pipeline.create_index);
         }
 
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE) ||
-            pipeline.IsDynamic(VK_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT)) {
+        if (pipeline.IsDynamic(CB_DYNAMIC_PRIMITIVE_RESTART_ENABLE_SET) ||
+            pipeline.IsDynamic(CB_DYNAMIC_PATCH_CONTROL_POINTS_EXT_SET)) {
             skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-07066",
                              "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                              "] pDynamicState must not contain "
@@ -2449,7 +2449,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
                              pipeline.create_index);
         }
 
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        if (pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_EXT_SET)) {
             skip |= LogError(
                 device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-07067",
                 "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
@@ -2459,13 +2459,13 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (api_version < VK_API_VERSION_1_3 && !enabled_features.extended_dynamic_state_features.extendedDynamicState &&
-        (pipeline.IsDynamic(VK_DYNAMIC_STATE_CULL_MODE) || pipeline.IsDynamic(VK_DYNAMIC_STATE_FRONT_FACE) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY) || pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE) || pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP) || pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE) || pipeline.IsDynamic(VK_DYNAMIC_STATE_STENCIL_OP))) {
+        (pipeline.IsDynamic(CB_DYNAMIC_CULL_MODE_SET) || pipeline.IsDynamic(CB_DYNAMIC_FRONT_FACE_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_PRIMITIVE_TOPOLOGY_SET) || pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_WITH_COUNT_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_SCISSOR_WITH_COUNT_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_DEPTH_TEST_ENABLE_SET) || pipeline.IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_DEPTH_COMPARE_OP_SET) || pipeline.IsDynamic(CB_DYNAMIC_DEPTH_BOUNDS_TEST_ENABLE_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_STENCIL_TEST_ENABLE_SET) || pipeline.IsDynamic(CB_DYNAMIC_STENCIL_OP_SET))) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-03378",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the extendedDynamicState "
@@ -2474,8 +2474,8 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (api_version < VK_API_VERSION_1_3 && !enabled_features.extended_dynamic_state2_features.extendedDynamicState2 &&
-        (pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE) || pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE) ||
-         pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE))) {
+        (pipeline.IsDynamic(CB_DYNAMIC_RASTERIZER_DISCARD_ENABLE_SET) || pipeline.IsDynamic(CB_DYNAMIC_DEPTH_BIAS_ENABLE_SET) ||
+         pipeline.IsDynamic(CB_DYNAMIC_PRIMITIVE_RESTART_ENABLE_SET))) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-04868",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the extendedDynamicState2 "
@@ -2484,7 +2484,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state2_features.extendedDynamicState2LogicOp &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_LOGIC_OP_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_LOGIC_OP_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-04869",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2493,7 +2493,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state2_features.extendedDynamicState2PatchControlPoints &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_PATCH_CONTROL_POINTS_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-04870",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2503,7 +2503,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3TessellationDomainOrigin &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_TESSELLATION_DOMAIN_ORIGIN_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3TessellationDomainOrigin-07370",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2513,7 +2513,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3DepthClampEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_DEPTH_CLAMP_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3DepthClampEnable-07371",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2523,7 +2523,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3PolygonMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_POLYGON_MODE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_POLYGON_MODE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3PolygonMode-07372",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2533,7 +2533,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3RasterizationSamples &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3RasterizationSamples-07373",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2543,7 +2543,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3SampleMask &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_MASK_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_SAMPLE_MASK_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3SampleMask-07374",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2553,7 +2553,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3AlphaToCoverageEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_ALPHA_TO_COVERAGE_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3AlphaToCoverageEnable-07375",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2563,7 +2563,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3AlphaToOneEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_ALPHA_TO_ONE_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3AlphaToOneEnable-07376",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2573,7 +2573,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3LogicOpEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_LOGIC_OP_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3LogicOpEnable-07377",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2583,7 +2583,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ColorBlendEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ColorBlendEnable-07378",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2593,7 +2593,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ColorBlendEquation &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_EQUATION_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ColorBlendEquation-07379",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2603,7 +2603,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ColorWriteMask &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COLOR_WRITE_MASK_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ColorWriteMask-07380",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2613,7 +2613,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3RasterizationStream &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_STREAM_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3RasterizationStream-07381",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2623,7 +2623,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ConservativeRasterizationMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_CONSERVATIVE_RASTERIZATION_MODE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ConservativeRasterizationMode-07382",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2633,7 +2633,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ExtraPrimitiveOverestimationSize &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ExtraPrimitiveOverestimationSize-07383",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2643,7 +2643,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3DepthClipEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_DEPTH_CLIP_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3DepthClipEnable-07384",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2653,7 +2653,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3SampleLocationsEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_SAMPLE_LOCATIONS_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3SampleLocationsEnable-07385",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2663,7 +2663,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ColorBlendAdvanced &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ADVANCED_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COLOR_BLEND_ADVANCED_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ColorBlendAdvanced-07386",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2673,7 +2673,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ProvokingVertexMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_PROVOKING_VERTEX_MODE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ProvokingVertexMode-07387",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2683,7 +2683,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3LineRasterizationMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_LINE_RASTERIZATION_MODE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3LineRasterizationMode-07388",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2693,7 +2693,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3LineStippleEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_LINE_STIPPLE_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3LineStippleEnable-07389",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2703,7 +2703,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3DepthClipNegativeOneToOne &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3DepthClipNegativeOneToOne-07390",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2713,7 +2713,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ViewportWScalingEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_W_SCALING_ENABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ViewportWScalingEnable-07391",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2723,7 +2723,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ViewportSwizzle &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_SWIZZLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ViewportSwizzle-07392",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2733,7 +2733,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageToColorEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_TO_COLOR_ENABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageToColorEnable-07393",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2743,7 +2743,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageToColorLocation &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_TO_COLOR_LOCATION_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageToColorLocation-07394",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2753,7 +2753,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageModulationMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_MODULATION_MODE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageModulationMode-07395",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2763,7 +2763,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageModulationTableEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_MODULATION_TABLE_ENABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageModulationTableEnable-07396",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2773,7 +2773,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageModulationTable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_MODULATION_TABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageModulationTable-07397",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2783,7 +2783,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3CoverageReductionMode &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_COVERAGE_REDUCTION_MODE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3CoverageReductionMode-07398",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2793,7 +2793,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3RepresentativeFragmentTestEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3RepresentativeFragmentTestEnable-07399",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2803,7 +2803,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.extended_dynamic_state3_features.extendedDynamicState3ShadingRateImageEnable &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV)) {
+        pipeline.IsDynamic(CB_DYNAMIC_SHADING_RATE_IMAGE_ENABLE_NV_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-extendedDynamicState3ShadingRateImageEnable-07400",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: Extended dynamic state used by the "
@@ -2813,7 +2813,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
     }
 
     if (!enabled_features.vertex_input_dynamic_state_features.vertexInputDynamicState &&
-        pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-04807",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: The vertexInputDynamicState feature must be enabled to use "
@@ -2821,7 +2821,7 @@ bool CoreChecks::ValidateGraphicsPipelineDynamicState(const PIPELINE_STATE &pipe
                          pipeline.create_index);
     }
 
-    if (!enabled_features.color_write_features.colorWriteEnable && pipeline.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT)) {
+    if (!enabled_features.color_write_features.colorWriteEnable && pipeline.IsDynamic(CB_DYNAMIC_COLOR_WRITE_ENABLE_EXT_SET)) {
         skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicStates-04800",
                          "vkCreateGraphicsPipelines() pCreateInfos[%" PRIu32
                          "]: The colorWriteEnable feature must be enabled to use the "
@@ -2836,7 +2836,7 @@ bool CoreChecks::ValidateGraphicsPipelineFragmentShadingRateState(const PIPELINE
     bool skip = false;
     const VkPipelineFragmentShadingRateStateCreateInfoKHR *fragment_shading_rate_state =
         LvlFindInChain<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pipeline.PNext());
-    if (fragment_shading_rate_state && !pipeline.IsDynamic(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR)) {
+    if (fragment_shading_rate_state && !pipeline.IsDynamic(CB_DYNAMIC_FRAGMENT_SHADING_RATE_KHR_SET)) {
         const char *struct_name = "VkPipelineFragmentShadingRateStateCreateInfoKHR";
 
         if (fragment_shading_rate_state->fragmentSize.width == 0) {
@@ -2945,14 +2945,13 @@ bool CoreChecks::ValidateGraphicsPipelineFragmentShadingRateState(const PIPELINE
 
         const auto combiner_ops = fragment_shading_rate_state->combinerOps;
         if (pipeline.pre_raster_state || pipeline.fragment_shader_state) {
-            const auto enums = ValidParamValues<VkFragmentShadingRateCombinerOpKHR>();
-            if (std::find(enums.begin(), enums.end(), combiner_ops[0]) == enums.end()) {
+            if (!IsValidEnumValue(combiner_ops[0])) {
                 skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicState-06567",
                                  "vkCreateGraphicsPipelines(): in pCreateInfos[%" PRIu32
                                  "], combinerOp[0] (%s) is not a valid VkFragmentShadingRateCombinerOpKHR value.",
                                  pipeline.create_index, string_VkFragmentShadingRateCombinerOpKHR(combiner_ops[0]));
             }
-            if (std::find(enums.begin(), enums.end(), combiner_ops[1]) == enums.end()) {
+            if (!IsValidEnumValue(combiner_ops[1])) {
                 skip |= LogError(device, "VUID-VkGraphicsPipelineCreateInfo-pDynamicState-06568",
                                  "vkCreateGraphicsPipelines(): in pCreateInfos[%" PRIu32
                                  "], combinerOp[1] (%s) is not a valid VkFragmentShadingRateCombinerOpKHR value.",
@@ -3133,8 +3132,8 @@ bool CoreChecks::ValidateGraphicsPipelineBindPoint(const CMD_BUFFER_STATE *cb_st
 
     if (cb_state->inheritedViewportDepths.size() != 0) {
         bool dyn_viewport =
-            pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) || pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT);
-        bool dyn_scissor = pipeline.IsDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT) || pipeline.IsDynamic(VK_DYNAMIC_STATE_SCISSOR);
+            pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_WITH_COUNT_SET) || pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_SET);
+        bool dyn_scissor = pipeline.IsDynamic(CB_DYNAMIC_SCISSOR_WITH_COUNT_SET) || pipeline.IsDynamic(CB_DYNAMIC_SCISSOR_SET);
         if (!dyn_viewport || !dyn_scissor) {
             const LogObjectList objlist(cb_state->commandBuffer(), pipeline.pipeline());
             skip |= LogError(objlist, "VUID-vkCmdBindPipeline-commandBuffer-04808",
@@ -3142,8 +3141,8 @@ bool CoreChecks::ValidateGraphicsPipelineBindPoint(const CMD_BUFFER_STATE *cb_st
         }
         const auto *discard_rectangle_state = LvlFindInChain<VkPipelineDiscardRectangleStateCreateInfoEXT>(pipeline.PNext());
         if ((discard_rectangle_state && discard_rectangle_state->discardRectangleCount != 0) ||
-            (pipeline.IsDynamic(VK_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT))) {
-            if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_DISCARD_RECTANGLE_EXT)) {
+            (pipeline.IsDynamic(CB_DYNAMIC_DISCARD_RECTANGLE_ENABLE_EXT_SET))) {
+            if (!pipeline.IsDynamic(CB_DYNAMIC_DISCARD_RECTANGLE_EXT_SET)) {
                 const LogObjectList objlist(cb_state->commandBuffer(), pipeline.pipeline());
                 skip |= LogError(objlist, "VUID-vkCmdBindPipeline-commandBuffer-04809",
                                  "vkCmdBindPipeline(): commandBuffer is a secondary command buffer with "
@@ -3246,7 +3245,7 @@ bool CoreChecks::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer, V
                 const auto *multisample_state = pipeline_state.MultisampleState();
                 const auto *sample_locations = LvlFindInChain<VkPipelineSampleLocationsStateCreateInfoEXT>(multisample_state);
                 if (sample_locations && sample_locations->sampleLocationsEnable == VK_TRUE &&
-                    !pipeline_state.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT)) {
+                    !pipeline_state.IsDynamic(CB_DYNAMIC_SAMPLE_LOCATIONS_EXT_SET)) {
                     const VkRenderPassSampleLocationsBeginInfoEXT *sample_locations_begin_info =
                         LvlFindInChain<VkRenderPassSampleLocationsBeginInfoEXT>(cb_state->activeRenderPassBeginInfo.pNext);
                     bool found = false;
@@ -3418,17 +3417,17 @@ bool CoreChecks::ValidatePipelineRenderpassDraw(const LAST_BOUND_STATE &state, c
         if (ds_state) {
             const auto &dynamic_state_value = cb_state.dynamic_state_value;
             // Set with static values and update for anything dynamically set
-            const bool depth_write_enable = pipeline.IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE)
+            const bool depth_write_enable = pipeline.IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET)
                                                 ? dynamic_state_value.depth_write_enable
                                                 : ds_state->depthWriteEnable;
             VkStencilOpState front = ds_state->front;
             VkStencilOpState back = ds_state->back;
 
-            if (pipeline.IsDynamic(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK)) {
+            if (pipeline.IsDynamic(CB_DYNAMIC_STENCIL_WRITE_MASK_SET)) {
                 front.writeMask = dynamic_state_value.write_mask_front;
                 back.writeMask = dynamic_state_value.write_mask_back;
             }
-            if (pipeline.IsDynamic(VK_DYNAMIC_STATE_STENCIL_OP)) {
+            if (pipeline.IsDynamic(CB_DYNAMIC_STENCIL_OP_SET)) {
                 front.failOp = dynamic_state_value.fail_op_front;
                 front.passOp = dynamic_state_value.pass_op_front;
                 front.depthFailOp = dynamic_state_value.depth_fail_op_front;
@@ -3705,19 +3704,13 @@ bool CoreChecks::ValidatePipelineDynamicRenderpassDraw(const LAST_BOUND_STATE &s
 
 // Validate draw-time state related to the PSO
 bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, const CMD_BUFFER_STATE &cb_state, CMD_TYPE cmd_type,
-                                               const PIPELINE_STATE &pipeline) const {
+                                               const PIPELINE_STATE &pipeline, bool *failed) const {
     bool skip = false;
     const auto &current_vtx_bfr_binding_info = cb_state.current_vertex_buffer_binding_info.vertex_buffer_bindings;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(cmd_type);
     const char *caller = CommandTypeString(cmd_type);
 
     if (cb_state.activeRenderPass) {
-        if (cb_state.activeRenderPass->UsesDynamicRendering()) {
-            ValidatePipelineDynamicRenderpassDraw(state, cb_state, cmd_type, pipeline);
-        } else {
-            ValidatePipelineRenderpassDraw(state, cb_state, cmd_type, pipeline);
-        }
-
         if (pipeline.fragment_output_state && pipeline.fragment_output_state->dual_source_blending) {
             uint32_t count =
                 cb_state.activeRenderPass->UsesDynamicRendering()
@@ -3725,6 +3718,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                     : cb_state.activeRenderPass->createInfo.pSubpasses[cb_state.GetActiveSubpass()].colorAttachmentCount;
             if (count > phys_dev_props.limits.maxFragmentDualSrcAttachments) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(
                     objlist, "VUID-RuntimeSpirv-Fragment-06427",
                     "%s: Dual source blend mode is used, but the number of written fragment shader output attachment (%" PRIu32
@@ -3753,6 +3747,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                 if (!primitives_generated_query_with_rasterizer_discard && rp_state &&
                     rp_state->rasterizerDiscardEnable == VK_TRUE) {
                     const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                    *failed = true;
                     skip |= LogError(objlist, vuid.primitives_generated_06708,
                                      "%s: a VK_QUERY_TYPE_PRIMITIVES_GENERATED_EXT query is active and pipeline was created with "
                                      "VkPipelineRasterizationStateCreateInfo::rasterizerDiscardEnable set to VK_TRUE, but  "
@@ -3764,6 +3759,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                         LvlFindInChain<VkPipelineRasterizationStateStreamCreateInfoEXT>(rp_state->pNext);
                     if (rasterization_state_stream_ci && rasterization_state_stream_ci->rasterizationStream != 0) {
                         const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                        *failed = true;
                         skip |=
                             LogError(objlist, vuid.primitives_generated_streams_06709,
                                      "%s: a VK_QUERY_TYPE_PRIMITIVES_GENERATED_EXT query is active and pipeline was created with "
@@ -3783,12 +3779,12 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
         for (const auto &buffer_binding : current_vtx_bfr_binding_info) {
             if (buffer_binding.buffer_state && !buffer_binding.buffer_state->Destroyed()) {
                 skip |= ValidateProtectedBuffer(cb_state, *buffer_binding.buffer_state, caller,
-                                                vuid.unprotected_command_buffer_02707, "Buffer is vertex buffer");
+                                                vuid.unprotected_command_buffer_02707, "Buffer is vertex buffer", failed);
             }
         }
         if (cb_state.index_buffer_binding.bound()) {
             skip |= ValidateProtectedBuffer(cb_state, *cb_state.index_buffer_binding.buffer_state, caller,
-                                            vuid.unprotected_command_buffer_02707, "Buffer is index buffer");
+                                            vuid.unprotected_command_buffer_02707, "Buffer is index buffer", failed);
         }
     }
 
@@ -3798,6 +3794,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
             const auto vertex_binding = pipeline.vertex_input_state->binding_descriptions[i].binding;
             if (current_vtx_bfr_binding_info.size() < (vertex_binding + 1)) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.vertex_binding_04007,
                                  "%s: %s expects that this Command Buffer's vertex binding Index %u should be set via "
                                  "vkCmdBindVertexBuffers. This is because pVertexBindingDescriptions[%zu].binding value is %u.",
@@ -3806,6 +3803,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
             } else if ((current_vtx_bfr_binding_info[vertex_binding].buffer_state == nullptr) &&
                        !enabled_features.robustness2_features.nullDescriptor) {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.vertex_binding_null_04008,
                                  "%s: Vertex binding %d must not be VK_NULL_HANDLE %s expects that this Command Buffer's vertex "
                                  "binding Index %u should be set via "
@@ -3828,12 +3826,13 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                  enabled_features.robustness2_features.nullDescriptor)) {
                 uint32_t vertex_buffer_stride =
                     pipeline.vertex_input_state->binding_descriptions[vertex_binding_map_it->second].stride;
-                if (pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT)) {
+                if (pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET)) {
                     vertex_buffer_stride = static_cast<uint32_t>(current_vtx_bfr_binding_info[vertex_binding].stride);
                     const uint32_t attribute_binding_extent =
                         attribute_description.offset + FormatElementSize(attribute_description.format);
                     if (vertex_buffer_stride != 0 && vertex_buffer_stride < attribute_binding_extent) {
                         const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                        *failed = true;
                         skip |= LogError(objlist, "VUID-vkCmdBindVertexBuffers2-pStrides-06209",
                                          "The pStrides[%" PRIu32 "] (%" PRIu32
                                          ") parameter in the last call to %s is not 0 "
@@ -3852,6 +3851,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                 if (SafeModulo(attrib_address, vtx_attrib_req_alignment) != 0) {
                     const LogObjectList objlist(current_vtx_bfr_binding_info[vertex_binding].buffer_state->buffer(),
                                                 pipeline.pipeline());
+                    *failed = true;
                     skip |=
                         LogError(objlist, vuid.vertex_binding_attribute_02721,
                                  "%s: Format %s has an alignment of %" PRIu64 " but the alignment of attribAddress (%" PRIu64
@@ -3865,6 +3865,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                 }
             } else {
                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline());
+                *failed = true;
                 skip |= LogError(objlist, vuid.vertex_binding_attribute_02721,
                                  "%s: binding #%" PRIu32 " in pVertexAttributeDescriptions[%" PRIu32 "] is an invalid values.",
                                  caller, vertex_binding, i);
@@ -3899,6 +3900,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                                 color_blend_state->pAttachments[i].blendEnable != VK_FALSE) {
                                 const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(),
                                                             cb_state.activeRenderPass->renderPass());
+                                *failed = true;
                                 skip |=
                                     LogError(objlist, vuid.blend_enable_04727,
                                              "%s: Image view's format features of the color attachment (%" PRIu32
@@ -3926,6 +3928,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                     const char *vuid_string = IsExtEnabled(device_extensions.vk_ext_multisampled_render_to_single_sampled)
                                                   ? vuid.msrtss_rasterization_samples_07284
                                                   : vuid.rasterization_samples_04740;
+                    *failed = true;
                     skip |= LogError(objlist, vuid_string,
                                      "%s: In %s the sample count is %s while the current %s has %s and they need to be the same.",
                                      caller, report_data->FormatHandle(pipeline.pipeline()).c_str(),
@@ -3934,8 +3937,8 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                                      string_VkSampleCountFlags(static_cast<VkSampleCountFlags>(subpass_num_samples)).c_str());
                 }
 
-                const bool dynamic_line_raster_mode = pipeline.IsDynamic(VK_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT);
-                const bool dynamic_line_stipple_enable = pipeline.IsDynamic(VK_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT);
+                const bool dynamic_line_raster_mode = pipeline.IsDynamic(CB_DYNAMIC_LINE_RASTERIZATION_MODE_EXT_SET);
+                const bool dynamic_line_stipple_enable = pipeline.IsDynamic(CB_DYNAMIC_LINE_STIPPLE_ENABLE_EXT_SET);
                 if (dynamic_line_stipple_enable || dynamic_line_raster_mode) {
                     const auto raster_line_state =
                         LvlFindInChain<VkPipelineRasterizationLineStateCreateInfoEXT>(raster_state->pNext);
@@ -3952,6 +3955,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                             (!enabled_features.line_rasterization_features.stippledRectangularLines)) {
                             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(),
                                                         cb_state.activeRenderPass->renderPass());
+                            *failed = true;
                             skip |=
                                 LogError(objlist, vuid.stippled_rectangular_lines_07495,
                                          "%s(): lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_RECTANGULAR_EXT (set %s) with "
@@ -3963,6 +3967,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                             (!enabled_features.line_rasterization_features.stippledBresenhamLines)) {
                             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(),
                                                         cb_state.activeRenderPass->renderPass());
+                            *failed = true;
                             skip |= LogError(objlist, vuid.stippled_bresenham_lines_07496,
                                              "%s(): lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_BRESENHAM_EXT (set %s) with "
                                              "stippledLineEnable (set %s) but the stippledBresenhamLines feature is not enabled.",
@@ -3973,6 +3978,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                             (!enabled_features.line_rasterization_features.stippledSmoothLines)) {
                             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(),
                                                         cb_state.activeRenderPass->renderPass());
+                            *failed = true;
                             skip |= LogError(
                                 objlist, vuid.stippled_smooth_lines_07497,
                                 "%s(): lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_RECTANGULAR_SMOOTH_EXT (set %s) with "
@@ -3985,6 +3991,7 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
                              !phys_dev_props.limits.strictLines)) {
                             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(),
                                                         cb_state.activeRenderPass->renderPass());
+                            *failed = true;
                             skip |= LogError(
                                 objlist, vuid.stippled_default_strict_07498,
                                 "%s(): lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_DEFAULT_EXT (set %s) with "
@@ -3999,13 +4006,14 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LAST_BOUND_STATE &state, co
             }
         } else {
             const LogObjectList objlist(cb_state.commandBuffer(), pipeline.pipeline(), cb_state.activeRenderPass->renderPass());
+            *failed = true;
             skip |=
                 LogError(objlist, kVUID_Core_DrawState_NoActiveRenderpass, "%s: No active render pass found at draw-time.", caller);
         }
     }
 
     if (enabled_features.fragment_shading_rate_features.primitiveFragmentShadingRate) {
-        skip |= ValidateGraphicsPipelineShaderDynamicState(pipeline, cb_state, caller, vuid);
+        skip |= ValidateGraphicsPipelineShaderDynamicState(pipeline, cb_state, caller, vuid, failed);
     }
 
     return skip;
@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cinttypes>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -57,7 +58,7 @@ static uint32_t GetFormatType(VkFormat fmt) {
 }
 
 bool CoreChecks::ValidateViAgainstVsInputs(const PIPELINE_STATE &pipeline, const SHADER_MODULE_STATE &module_state,
-                                           const SHADER_MODULE_STATE::EntryPoint &entrypoint) const {
+                                           const SHADER_MODULE_STATE::EntryPoint &entrypoint, bool *failed) const {
     bool skip = false;
     safe_VkPipelineVertexInputStateCreateInfo const *vi = pipeline.vertex_input_state->input_state;
 
@@ -93,11 +94,13 @@ bool CoreChecks::ValidateViAgainstVsInputs(const PIPELINE_STATE &pipeline, const
         const auto input = location_it.second.input;
 
         if (attrib && !input) {
+            *failed = true;
             skip |= LogPerformanceWarning(module_state.vk_shader_module(), kVUID_Core_Shader_OutputNotConsumed,
                                           "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                                           "] Vertex attribute at location %" PRIu32 " not consumed by vertex shader",
                                           pipeline.create_index, location);
         } else if (!attrib && input) {
+            *failed = true;
             skip |= LogError(module_state.vk_shader_module(), "VUID-VkGraphicsPipelineCreateInfo-Input-07905",
                              "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                              "] Vertex shader consumes input at location %" PRIu32 " but not provided",
@@ -108,6 +111,7 @@ bool CoreChecks::ValidateViAgainstVsInputs(const PIPELINE_STATE &pipeline, const
 
             // Type checking
             if (!(attrib_type & input_type)) {
+                *failed = true;
                 skip |= LogError(module_state.vk_shader_module(), "VUID-VkGraphicsPipelineCreateInfo-Input-08733",
                                  "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                                  "] Attribute type of `%s` at location %" PRIu32 " does not match vertex shader input type of `%s`",
@@ -124,7 +128,7 @@ bool CoreChecks::ValidateViAgainstVsInputs(const PIPELINE_STATE &pipeline, const
 
 bool CoreChecks::ValidateFsOutputsAgainstDynamicRenderingRenderPass(const SHADER_MODULE_STATE &module_state,
                                                                     const SHADER_MODULE_STATE::EntryPoint &entrypoint,
-                                                                    const PIPELINE_STATE &pipeline) const {
+                                                                    const PIPELINE_STATE &pipeline, bool *failed) const {
     bool skip = false;
 
     struct Attachment {
@@ -148,6 +152,7 @@ bool CoreChecks::ValidateFsOutputsAgainstDynamicRenderingRenderPass(const SHADER
         const auto &rp_state = pipeline.RenderPassState();
         const auto &attachments = pipeline.Attachments();
         if (!output && location < attachments.size() && attachments[location].colorWriteMask != 0) {
+            *failed = true;
             skip |= LogWarning(module_state.vk_shader_module(), kVUID_Core_Shader_InputNotProduced,
                                "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Attachment %" PRIu32
                                " not written by fragment shader; undefined values will be written to attachment",
@@ -160,6 +165,7 @@ bool CoreChecks::ValidateFsOutputsAgainstDynamicRenderingRenderPass(const SHADER
 
             // Type checking
             if (!(output_type & attachment_type)) {
+                *failed = true;
                 skip |= LogWarning(
                     module_state.vk_shader_module(), kVUID_Core_Shader_FragmentOutputMismatch,
                     "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Attachment %" PRIu32
@@ -253,7 +259,7 @@ bool CoreChecks::ValidateConservativeRasterization(const SHADER_MODULE_STATE &mo
 
 bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE &module_state,
                                                     const SHADER_MODULE_STATE::EntryPoint &entrypoint,
-                                                    const PIPELINE_STATE &pipeline, uint32_t subpass_index) const {
+                                                    const PIPELINE_STATE &pipeline, uint32_t subpass_index, bool *failed) const {
     bool skip = false;
 
     struct Attachment {
@@ -305,6 +311,7 @@ bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE &m
             if (attachment && !output) {
                 const auto &attachments = pipeline.Attachments();
                 if (location < attachments.size() && attachments[location].colorWriteMask != 0) {
+                    *failed = true;
                     skip |= LogWarning(module_state.vk_shader_module(), kVUID_Core_Shader_InputNotProduced,
                                        "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Attachment %" PRIu32
                                        " not written by fragment shader; undefined values will be written to attachment",
@@ -312,6 +319,7 @@ bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE &m
                 }
             } else if (!attachment && output) {
                 if (!(alpha_to_coverage_enabled && location == 0)) {
+                    *failed = true;
                     skip |= LogWarning(module_state.vk_shader_module(), kVUID_Core_Shader_OutputNotConsumed,
                                        "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                                        "] fragment shader writes to output location %" PRIu32 " with no matching attachment",
@@ -323,6 +331,7 @@ bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE &m
 
                 // Type checking
                 if (!(output_type & attachment_type)) {
+                    *failed = true;
                     skip |= LogWarning(
                         module_state.vk_shader_module(), kVUID_Core_Shader_FragmentOutputMismatch,
                         "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Attachment %" PRIu32
@@ -1936,7 +1945,7 @@ bool CoreChecks::ValidatePrimitiveRateShaderState(const PIPELINE_STATE &pipeline
     const auto viewport_state = pipeline.ViewportState();
     if (!phys_dev_ext_props.fragment_shading_rate_props.primitiveFragmentShadingRateWithMultipleViewports &&
         (pipeline.pipeline_type == VK_PIPELINE_BIND_POINT_GRAPHICS) && viewport_state) {
-        if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) && viewport_state->viewportCount > 1 &&
+        if (!pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_WITH_COUNT_SET) && viewport_state->viewportCount > 1 &&
             entrypoint.written_builtin_primitive_shading_rate_khr) {
             skip |= LogError(module_state.vk_shader_module(),
                              "VUID-VkGraphicsPipelineCreateInfo-primitiveFragmentShadingRateWithMultipleViewports-04503",
@@ -2924,7 +2933,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                                                 const SHADER_MODULE_STATE::EntryPoint &producer_entrypoint,
                                                 const SHADER_MODULE_STATE &consumer,
                                                 const SHADER_MODULE_STATE::EntryPoint &consumer_entrypoint,
-                                                uint32_t pipe_index) const {
+                                                uint32_t pipe_index, bool *failed) const {
     bool skip = false;
 
     if (producer_entrypoint.has_passthrough) {
@@ -2983,6 +2992,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                 if ((component_info.output_type != component_info.input_type) ||
                     (component_info.output_width != component_info.input_width)) {
                     const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+                    *failed = true;
                     skip |=
                         LogError(objlist, "VUID-RuntimeSpirv-OpEntryPoint-07754",
                                  "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Type mismatch on Location %" PRIu32
@@ -2997,6 +3007,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                     (consumer_stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) &&
                     (input_var->is_patch != output_var->is_patch)) {
                     const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+                    *failed = true;
                     skip |= LogError(objlist, kVUID_Core_Shader_InterfacePatchVertex,
                                      "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] at Location %" PRIu32
                                      " Comonent %" PRIu32 " Tessellation Control is %s while Tessellation Evalutaion is %s",
@@ -3012,6 +3023,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                     const uint32_t input_vec_size = input_var->base_type.Word(3);
                     if (output_vec_size > input_vec_size) {
                         const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+                        *failed = true;
                         skip |=
                             LogError(objlist, "VUID-RuntimeSpirv-maintenance4-06817",
                                      "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] starting at Location %" PRIu32
@@ -3029,6 +3041,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                 // Don't give any warning if maintenance4 with vectors
                 if (!enabled_features.core13.maintenance4 && (output_var->base_type.Opcode() != spv::OpTypeVector)) {
                     const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+                    *failed = true;
                     skip |= LogPerformanceWarning(objlist, kVUID_Core_Shader_OutputNotConsumed,
                                                   "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
                                                   "] %s declared to output location %" PRIu32 " Comonent %" PRIu32
@@ -3044,6 +3057,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                     break;  // When going inbetween Tessellation or Geometry, array size can be different
                 }
                 const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+                *failed = true;
                 skip |= LogError(objlist, "VUID-RuntimeSpirv-OpEntryPoint-08743",
                                  "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] %s declared input at Location %" PRIu32
                                  " Comonent %" PRIu32 " but it is not an Output declared in %s",
@@ -3104,6 +3118,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
         }
         msg << "}\n";
         const LogObjectList objlist(producer.vk_shader_module(), consumer.vk_shader_module());
+        *failed = true;
         skip |= LogError(objlist, kVUID_Core_Shader_BuiltinMismatch,
                          "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32 "] Mistmatch in BuiltIn blocks:\n %s", pipe_index,
                          msg.str().c_str());
@@ -3139,9 +3154,25 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE &pipel
     // if the shader stages are no good individually, cross-stage validation is pointless.
     if (skip) return true;
 
+    // A pipeline linked only from libraries checks nothing but how the libraries fit together, so relinking a set of libraries
+    // that has linked cleanly before can skip it.
+    const bool dynamic_vertex_input = pipeline.IsDynamic(CB_DYNAMIC_VERTEX_INPUT_EXT_SET);
+    std::optional<LibraryLinkCache::SubStates> link_sub_states;
+    if (pipeline.library_create_info && pipeline.create_info_shaders == 0 && !pipeline.OwnsSubState(pipeline.vertex_input_state) &&
+        !pipeline.OwnsSubState(pipeline.pre_raster_state) && !pipeline.OwnsSubState(pipeline.fragment_shader_state) &&
+        !pipeline.OwnsSubState(pipeline.fragment_output_state)) {
+        link_sub_states = LibraryLinkCache::SubStates{pipeline.vertex_input_state, pipeline.pre_raster_state,
+                                                      pipeline.fragment_shader_state, pipeline.fragment_output_state};
+        if (library_link_cache.Contains(*link_sub_states, dynamic_vertex_input)) {
+            return skip;
+        }
+    }
+    // Set by any of the checks that finds a problem, whether or not its message is reported
+    bool failed = false;
+
     if (pipeline.vertex_input_state && vertex_stage && vertex_stage->entrypoint && vertex_stage->module_state->has_valid_spirv &&
-        !pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
-        skip |= ValidateViAgainstVsInputs(pipeline, *vertex_stage->module_state.get(), *vertex_stage->entrypoint);
+        !dynamic_vertex_input) {
+        skip |= ValidateViAgainstVsInputs(pipeline, *vertex_stage->module_state.get(), *vertex_stage->entrypoint, &failed);
     }
 
     for (size_t i = 1; i < pipeline.stage_states.size(); i++) {
@@ -3155,7 +3186,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE &pipel
             if (consumer.module_state->has_valid_spirv && producer.module_state->has_valid_spirv && consumer.entrypoint &&
                 producer.entrypoint) {
                 skip |= ValidateInterfaceBetweenStages(*producer.module_state.get(), *producer.entrypoint,
-                                                       *consumer.module_state.get(), *consumer.entrypoint, pipeline.create_index);
+                                                       *consumer.module_state.get(), *consumer.entrypoint, pipeline.create_index,
+                                                       &failed);
             }
         }
     }
@@ -3164,26 +3196,31 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE &pipel
         const auto &rp_state = pipeline.RenderPassState();
         if (rp_state && rp_state->UsesDynamicRendering()) {
             skip |= ValidateFsOutputsAgainstDynamicRenderingRenderPass(*fragment_stage->module_state.get(),
-                                                                       *fragment_stage->entrypoint, pipeline);
+                                                                       *fragment_stage->entrypoint, pipeline, &failed);
         } else {
             skip |= ValidateFsOutputsAgainstRenderPass(*fragment_stage->module_state.get(), *fragment_stage->entrypoint, pipeline,
-                                                       pipeline.Subpass());
+                                                       pipeline.Subpass(), &failed);
         }
     }
 
+    if (link_sub_states && !failed) {
+        library_link_cache.Insert(*link_sub_states, dynamic_vertex_input);
+    }
+
     return skip;
 }
 
 bool CoreChecks::ValidateGraphicsPipelineShaderDynamicState(const PIPELINE_STATE &pipeline, const CMD_BUFFER_STATE &cb_state,
-                                                            const char *caller, const DrawDispatchVuid &vuid) const {
+                                                            const char *caller, const DrawDispatchVuid &vuid, bool *failed) const {
     bool skip = false;
 
     for (auto &stage_state : pipeline.stage_states) {
         const VkShaderStageFlagBits stage = stage_state.create_info->stage;
         if (stage == VK_SHADER_STAGE_VERTEX_BIT || stage == VK_SHADER_STAGE_GEOMETRY_BIT || stage == VK_SHADER_STAGE_MESH_BIT_EXT) {
             if (!phys_dev_ext_props.fragment_shading_rate_props.primitiveFragmentShadingRateWithMultipleViewports &&
-                pipeline.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) && cb_state.viewportWithCountCount != 1) {
+                pipeline.IsDynamic(CB_DYNAMIC_VIEWPORT_WITH_COUNT_SET) && cb_state.viewportWithCountCount != 1) {
                 if (stage_state.entrypoint && stage_state.entrypoint->written_builtin_primitive_shading_rate_khr) {
+                    *failed = true;
                     skip |= LogError(
                         stage_state.module_state.get()->vk_shader_module(), vuid.viewport_count_primitive_shading_rate_04552,
                         "%s: %s shader of currently bound pipeline statically writes to PrimitiveShadingRateKHR built-in"
@@ -3249,6 +3286,46 @@ bool CoreChecks::GroupHasValidIndex(const PIPELINE_STATE &pipeline, uint32_t gro
 
 uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
 
+LibraryLinkCache::Key LibraryLinkCache::MakeKey(const SubStates &sub_states, bool dynamic_vertex_input) {
+    Key key;
+    for (size_t i = 0; i < sub_states.size(); ++i) {
+        key.sub_states[i] = sub_states[i].get();
+    }
+    key.dynamic_vertex_input = dynamic_vertex_input;
+    return key;
+}
+
+bool LibraryLinkCache::Expired(const Key &key, const WeakSubStates &sub_states) {
+    for (size_t i = 0; i < sub_states.size(); ++i) {
+        // Pipelines without FS or FO state have a null entry, which was never tracked
+        if (key.sub_states[i] && sub_states[i].expired()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LibraryLinkCache::Contains(const SubStates &sub_states, bool dynamic_vertex_input) const {
+    auto guard = ReadLock();
+    const auto it = links_.find(MakeKey(sub_states, dynamic_vertex_input));
+    return it != links_.end() && !Expired(it->first, it->second);
+}
+
+void LibraryLinkCache::Insert(const SubStates &sub_states, bool dynamic_vertex_input) {
+    auto guard = WriteLock();
+    links_[MakeKey(sub_states, dynamic_vertex_input)] = {sub_states[0], sub_states[1], sub_states[2], sub_states[3]};
+    if (links_.size() >= prune_size_) {
+        for (auto it = links_.begin(); it != links_.end();) {
+            if (Expired(it->first, it->second)) {
+                it = links_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        prune_size_ = std::max(prune_size_, 2 * links_.size());
+    }
+}
+
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = LvlFindInChain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
     if (validation_cache_ci) {
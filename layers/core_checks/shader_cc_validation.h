@@ -20,15 +20,19 @@
 
 #pragma once
 
+#include <array>
 #include <cstdlib>
+#include <memory>
 
 #include "vulkan/vulkan.h"
 #include <generated/spirv_tools_commit_id.h>
 #include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
 #include "utils/vk_layer_utils.h"
 
 struct DeviceFeatures;
 struct DeviceExtensions;
+struct PipelineSubState;
 
 class ValidationCache {
   public:
@@ -145,6 +149,42 @@ class ValidationCache {
     mutable std::shared_mutex lock_;
 };
 
+// Graphics pipeline library links whose cross-stage shader checks have passed before, and can be skipped when the same
+// libraries are linked again. Like ValidationCache, only good results are stored.
+class LibraryLinkCache {
+  public:
+    // The sub-states of a pipeline linked only from libraries, in VI, pre-raster, FS, FO order
+    using SubStates = std::array<std::shared_ptr<const PipelineSubState>, 4>;
+
+    bool Contains(const SubStates &sub_states, bool dynamic_vertex_input) const;
+    void Insert(const SubStates &sub_states, bool dynamic_vertex_input);
+
+  private:
+    struct Key {
+        std::array<const PipelineSubState *, 4> sub_states;
+        bool dynamic_vertex_input;
+
+        bool operator==(const Key &rhs) const {
+            return sub_states == rhs.sub_states && dynamic_vertex_input == rhs.dynamic_vertex_input;
+        }
+        size_t hash() const {
+            return hash_util::HashCombiner().Combine(sub_states.cbegin(), sub_states.cend()).Combine(dynamic_vertex_input).Value();
+        }
+    };
+    // The sub-states are only held weakly, so the libraries can be destroyed. While any weak_ptr is around, the sub-state
+    // allocation can't be reused, so a live match is always the same library.
+    using WeakSubStates = std::array<std::weak_ptr<const PipelineSubState>, 4>;
+    static Key MakeKey(const SubStates &sub_states, bool dynamic_vertex_input);
+    static bool Expired(const Key &key, const WeakSubStates &sub_states);
+
+    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
+    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
+
+    vvl::unordered_map<Key, WeakSubStates, hash_util::HasHashMember<Key>> links_;
+    size_t prune_size_ = 64;  // expired links are removed when the map grows to this size
+    mutable std::shared_mutex lock_;
+};
+
 spv_target_env PickSpirvEnv(uint32_t api_version, bool spirv_1_4);
 
 void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
@@ -1927,29 +1927,26 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(
     // No release should have an extant duplicate (WARNING)
     for (const auto &release : cb_barriers.release) {
         // Check the global pending release barriers
-        const auto set_it = global_release_barriers.find(release.handle);
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            const auto found = set_for_handle.find(release);
-            if (found != set_for_handle.cend()) {
-                skip |= LogWarning(cb_state.commandBuffer(), TransferBarrier::ErrMsgDuplicateQFOSubmitted(),
-                                   "%s: %s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
-                                   " to dstQueueFamilyIndex %" PRIu32
-                                   " duplicates existing barrier queued for execution, without intervening acquire operation.",
-                                   "vkQueueSubmit()", barrier_name, handle_name, report_data->FormatHandle(found->handle).c_str(),
-                                   found->srcQueueFamilyIndex, found->dstQueueFamilyIndex);
-            }
+        bool duplicate_release_found = false;
+        global_release_barriers.visit(release.handle, [&release, &duplicate_release_found](const auto &set_for_handle) {
+            duplicate_release_found = set_for_handle.find(release) != set_for_handle.cend();
+        });
+        if (duplicate_release_found) {
+            skip |= LogWarning(cb_state.commandBuffer(), TransferBarrier::ErrMsgDuplicateQFOSubmitted(),
+                               "%s: %s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
+                               " to dstQueueFamilyIndex %" PRIu32
+                               " duplicates existing barrier queued for execution, without intervening acquire operation.",
+                               "vkQueueSubmit()", barrier_name, handle_name, report_data->FormatHandle(release.handle).c_str(),
+                               release.srcQueueFamilyIndex, release.dstQueueFamilyIndex);
         }
         skip |= ValidateAndUpdateQFOScoreboard(report_data, cb_state, "releasing", release, &scoreboards->release);
     }
     // Each acquire must have a matching release (ERROR)
     for (const auto &acquire : cb_barriers.acquire) {
-        const auto set_it = global_release_barriers.find(acquire.handle);
         bool matching_release_found = false;
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
+        global_release_barriers.visit(acquire.handle, [&acquire, &matching_release_found](const auto &set_for_handle) {
             matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
-        }
+        });
         if (!matching_release_found) {
             skip |= LogError(cb_state.commandBuffer(), TransferBarrier::ErrMsgMissingQFOReleaseInSubmit(),
                              "%s: in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
@@ -1979,28 +1976,20 @@ void RecordQueuedQFOTransferBarriers(QFOTransferBarrierSets<TransferBarrier> &cb
     // Add release barriers from this submit to the global map
     for (const auto &release : cb_barriers.release) {
         // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
-        // NOTE: vl_concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-        // copy back after updating.
-        auto iter = global_release_barriers.find(release.handle);
-        iter->second.insert(release);
-        global_release_barriers.insert_or_assign(release.handle, iter->second);
+        // NOTE: the set is updated in place under the map's lock, rather than copied out by find() and back again.
+        global_release_barriers.update(release.handle, [&release](QFOTransferBarrierSet<TransferBarrier> &set_for_handle) {
+            set_for_handle.insert(release);
+            return true;
+        });
     }
 
     // Erase acquired barriers from this submit from the global map -- essentially marking releases as consumed
     for (const auto &acquire : cb_barriers.acquire) {
-        // NOTE: We're not using [] because we don't want to create entries for missing releases
-        auto set_it = global_release_barriers.find(acquire.handle);
-        if (set_it != global_release_barriers.end()) {
-            QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
+        // Empty sets are cleaned up, which includes the set update() creates for a missing release
+        global_release_barriers.update(acquire.handle, [&acquire](QFOTransferBarrierSet<TransferBarrier> &set_for_handle) {
             set_for_handle.erase(acquire);
-            if (set_for_handle.size() == 0) {  // Clean up empty sets
-                global_release_barriers.erase(acquire.handle);
-            } else {
-                // NOTE: vl_concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-                // copy back after updating.
-                global_release_barriers.insert_or_assign(acquire.handle, set_for_handle);
-            }
-        }
+            return !set_for_handle.empty();
+        });
     }
 }
 
@@ -6225,8 +6225,9 @@ class ValidationObject {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
         };
 
+        // Returns true if value is a core value of the enumerated type T, or one added by an enabled extension
         template <typename T>
-        std::vector<T> ValidParamValues() const;
+        bool IsValidEnumValue(T value) const;
 };
 
 extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
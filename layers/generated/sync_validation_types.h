@@ -39,6 +39,19 @@ static const VkPipelineStageFlagBits2 VK_PIPELINE_STAGE_2_PRESENT_ENGINE_BIT_SYN
 static const VkAccessFlagBits2 VK_ACCESS_2_PRESENT_ACQUIRE_READ_BIT_SYNCVAL = 0x0000400000000000ULL;
 static const VkAccessFlagBits2 VK_ACCESS_2_PRESENT_PRESENTED_BIT_SYNCVAL = 0x0000800000000000ULL;
 
+// Converts a table keyed by single bit flags to an array indexed by bit position
+template <typename Value, typename Entries>
+constexpr std::array<Value, 64> syncBitIndexTable(const Entries &entries) {
+    std::array<Value, 64> table{};
+    for (const auto &entry : entries) {
+        if (!entry.first) continue;
+        size_t index = 0;
+        while ((entry.first >> index) > 1) ++index;
+        table[index] = entry.second;
+    }
+    return table;
+}
+
 // Unique number for each  stage/access combination
 enum SyncStageAccessIndex {
     SYNC_ACCESS_INDEX_NONE = 0,
@@ -400,6 +413,9 @@ static const SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all w
 // Bit order mask of stage_access bit for each stage
 const std::map<VkPipelineStageFlags2, SyncStageAccessFlags>& syncStageAccessMaskByStageBit();
 
+// Bit order mask of stage_access bit for each stage, indexed by bit position
+const std::array<SyncStageAccessFlags, 64>& syncStageAccessMaskByStageBitIndex();
+
 // Bit order mask of stage_access bit for each access
 const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAccessBit();
 
@@ -409,15 +425,24 @@ const std::map<VkPipelineStageFlags2, std::map<VkAccessFlags2, SyncStageAccessIn
 // Direct VkPipelineStageFlags to valid VkAccessFlags lookup table
 const std::map<VkPipelineStageFlags2, VkAccessFlags2>& syncDirectStageToAccessMask();
 
+// Direct VkPipelineStageFlags to valid VkAccessFlags lookup table, indexed by bit position
+const std::array<VkAccessFlags2, 64>& syncDirectStageToAccessMaskByBitIndex();
+
 // Pipeline stages corresponding to VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT for each VkQueueFlagBits
 const std::map<VkQueueFlagBits, VkPipelineStageFlags2>& syncAllCommandStagesByQueueFlags();
 
 // Masks of logically earlier stage flags for a given stage flag
 const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyEarlierStages();
 
+// Masks of logically earlier stage flags for a given stage flag, indexed by bit position
+const std::array<VkPipelineStageFlags2, 64>& syncLogicallyEarlierStagesByBitIndex();
+
 // Masks of logically later stage flags for a given stage flag
 const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyLaterStages();
 
+// Masks of logically later stage flags for a given stage flag, indexed by bit position
+const std::array<VkPipelineStageFlags2, 64>& syncLogicallyLaterStagesByBitIndex();
+
 // Lookup table of stage orderings
 const std::map<VkPipelineStageFlags2, int>& syncStageOrder();
 
@@ -20,132 +20,132 @@
  */
 
 
-template<> std::vector<VkResult> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPipelineCacheHeaderVersion> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkImageLayout> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkObjectType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkVendorId> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSystemAllocationScope> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkInternalAllocationType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFormat> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkImageTiling> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkImageType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPhysicalDeviceType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkQueryType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSharingMode> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkComponentSwizzle> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkImageViewType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBlendFactor> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBlendOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCompareOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDynamicState> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFrontFace> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkVertexInputRate> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPrimitiveTopology> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPolygonMode> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkStencilOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkLogicOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBorderColor> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFilter> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSamplerAddressMode> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSamplerMipmapMode> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDescriptorType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAttachmentLoadOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAttachmentStoreOp> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPipelineBindPoint> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCommandBufferLevel> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkIndexType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSubpassContents> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPointClippingBehavior> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkTessellationDomainOrigin> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSamplerYcbcrModelConversion> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSamplerYcbcrRange> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkChromaLocation> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDescriptorUpdateTemplateType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDriverId> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkShaderFloatControlsIndependence> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSamplerReductionMode> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkSemaphoreType> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPresentModeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkColorSpaceKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkQueryResultStatusKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceCounterUnitKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceCounterScopeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceCounterStorageKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkQueueGlobalPriorityKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFragmentShadingRateCombinerOpKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPipelineExecutableStatisticFormatKHR> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkResult value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPipelineCacheHeaderVersion value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkImageLayout value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkObjectType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkVendorId value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSystemAllocationScope value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkInternalAllocationType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFormat value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkImageTiling value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkImageType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPhysicalDeviceType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkQueryType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSharingMode value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkComponentSwizzle value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkImageViewType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBlendFactor value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBlendOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCompareOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDynamicState value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFrontFace value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkVertexInputRate value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPrimitiveTopology value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPolygonMode value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkStencilOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkLogicOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBorderColor value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFilter value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSamplerAddressMode value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSamplerMipmapMode value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDescriptorType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAttachmentLoadOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAttachmentStoreOp value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPipelineBindPoint value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCommandBufferLevel value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkIndexType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSubpassContents value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPointClippingBehavior value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkTessellationDomainOrigin value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSamplerYcbcrModelConversion value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSamplerYcbcrRange value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkChromaLocation value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDescriptorUpdateTemplateType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDriverId value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkShaderFloatControlsIndependence value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSamplerReductionMode value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkSemaphoreType value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPresentModeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkColorSpaceKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkQueryResultStatusKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceCounterUnitKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceCounterScopeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceCounterStorageKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkQueueGlobalPriorityKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFragmentShadingRateCombinerOpKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPipelineExecutableStatisticFormatKHR value) const;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkVideoEncodeTuningModeKHR> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkVideoEncodeTuningModeKHR value) const;
 #endif // VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkDebugReportObjectTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkRasterizationOrderAMD> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkDebugReportObjectTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkRasterizationOrderAMD value) const;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkVideoEncodeH264RateControlStructureEXT> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkVideoEncodeH264RateControlStructureEXT value) const;
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkVideoEncodeH265RateControlStructureEXT> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkVideoEncodeH265RateControlStructureEXT value) const;
 #endif // VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkShaderInfoTypeAMD> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkValidationCheckEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPipelineRobustnessBufferBehaviorEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPipelineRobustnessImageBehaviorEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDisplayPowerStateEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDeviceEventTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDisplayEventTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkViewportCoordinateSwizzleNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDiscardRectangleModeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkConservativeRasterizationModeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBlendOverlapEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCoverageModulationModeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkValidationCacheHeaderVersionEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkShadingRatePaletteEntryNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCoarseSampleOrderTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkRayTracingShaderGroupTypeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkGeometryTypeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAccelerationStructureTypeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCopyAccelerationStructureModeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAccelerationStructureMemoryRequirementsTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkTimeDomainEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkMemoryOverallocationBehaviorAMD> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceConfigurationTypeINTEL> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkQueryPoolSamplingModeINTEL> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceOverrideTypeINTEL> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceParameterTypeINTEL> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkPerformanceValueTypeINTEL> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkValidationFeatureEnableEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkValidationFeatureDisableEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkComponentTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkScopeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCoverageReductionModeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkProvokingVertexModeEXT> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkShaderInfoTypeAMD value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkValidationCheckEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPipelineRobustnessBufferBehaviorEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPipelineRobustnessImageBehaviorEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDisplayPowerStateEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDeviceEventTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDisplayEventTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkViewportCoordinateSwizzleNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDiscardRectangleModeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkConservativeRasterizationModeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBlendOverlapEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCoverageModulationModeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkValidationCacheHeaderVersionEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkShadingRatePaletteEntryNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCoarseSampleOrderTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkRayTracingShaderGroupTypeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkGeometryTypeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAccelerationStructureTypeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCopyAccelerationStructureModeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAccelerationStructureMemoryRequirementsTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkTimeDomainEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkMemoryOverallocationBehaviorAMD value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceConfigurationTypeINTEL value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkQueryPoolSamplingModeINTEL value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceOverrideTypeINTEL value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceParameterTypeINTEL value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkPerformanceValueTypeINTEL value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkValidationFeatureEnableEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkValidationFeatureDisableEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkComponentTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkScopeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCoverageReductionModeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkProvokingVertexModeEXT value) const;
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-template<> std::vector<VkFullScreenExclusiveEXT> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkFullScreenExclusiveEXT value) const;
 #endif // VK_USE_PLATFORM_WIN32_KHR
-template<> std::vector<VkLineRasterizationModeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkIndirectCommandsTokenTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDeviceMemoryReportEventTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFragmentShadingRateTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkFragmentShadingRateNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAccelerationStructureMotionInstanceTypeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDeviceFaultAddressTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDeviceFaultVendorBinaryHeaderVersionEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDeviceAddressBindingTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkMicromapTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBuildMicromapModeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkCopyMicromapModeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkOpacityMicromapFormatEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkOpacityMicromapSpecialIndexEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAccelerationStructureCompatibilityKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkAccelerationStructureBuildTypeKHR> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkLineRasterizationModeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkIndirectCommandsTokenTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDeviceMemoryReportEventTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFragmentShadingRateTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkFragmentShadingRateNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAccelerationStructureMotionInstanceTypeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDeviceFaultAddressTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDeviceFaultVendorBinaryHeaderVersionEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDeviceAddressBindingTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkMicromapTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBuildMicromapModeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkCopyMicromapModeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkOpacityMicromapFormatEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkOpacityMicromapSpecialIndexEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAccelerationStructureCompatibilityKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkAccelerationStructureBuildTypeKHR value) const;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkDisplacementMicromapFormatNV> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkDisplacementMicromapFormatNV value) const;
 #endif // VK_ENABLE_BETA_EXTENSIONS
-template<> std::vector<VkSubpassMergeStatusEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkDirectDriverLoadingModeLUNARG> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkOpticalFlowPerformanceLevelNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkOpticalFlowSessionBindingPointNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkShaderCodeTypeEXT> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkRayTracingInvocationReorderModeNV> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkBuildAccelerationStructureModeKHR> ValidationObject::ValidParamValues() const;
-template<> std::vector<VkShaderGroupShaderKHR> ValidationObject::ValidParamValues() const;
+template<> bool ValidationObject::IsValidEnumValue(VkSubpassMergeStatusEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkDirectDriverLoadingModeLUNARG value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkOpticalFlowPerformanceLevelNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkOpticalFlowSessionBindingPointNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkShaderCodeTypeEXT value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkRayTracingInvocationReorderModeNV value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkBuildAccelerationStructureModeKHR value) const;
+template<> bool ValidationObject::IsValidEnumValue(VkShaderGroupShaderKHR value) const;
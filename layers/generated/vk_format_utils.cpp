@@ -23,6 +23,8 @@
 
 #include "vk_format_utils.h"
 #include "utils/vk_layer_utils.h"
+#include <array>
+#include <limits>
 #include <vector>
 
 
@@ -43,19 +45,878 @@ struct COMPONENT_INFO {
     COMPONENT_TYPE type;
     uint32_t size; // bits
 
-    COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
-    COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
+    constexpr COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
+    constexpr COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
 };
 
+// Boolean properties of a format queried by the FormatIs* functions
+enum FORMAT_PROPERTY_BITS : uint32_t {
+    FORMAT_PROPERTY_PACKED = 1u << 0,
+    FORMAT_PROPERTY_COMPRESSED_ASTC_HDR = 1u << 1,
+    FORMAT_PROPERTY_COMPRESSED_ASTC_LDR = 1u << 2,
+    FORMAT_PROPERTY_COMPRESSED_BC = 1u << 3,
+    FORMAT_PROPERTY_COMPRESSED_EAC = 1u << 4,
+    FORMAT_PROPERTY_COMPRESSED_ETC2 = 1u << 5,
+    FORMAT_PROPERTY_COMPRESSED_PVRTC = 1u << 6,
+    FORMAT_PROPERTY_YCBCR_CONVERSION = 1u << 7,
+    FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED = 1u << 8,
+    FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED = 1u << 9,
+    FORMAT_PROPERTY_SINGLE_PLANE_422 = 1u << 10,
+};
+static constexpr uint32_t FORMAT_PROPERTY_COMPRESSED =
+    FORMAT_PROPERTY_COMPRESSED_ASTC_HDR | FORMAT_PROPERTY_COMPRESSED_ASTC_LDR | FORMAT_PROPERTY_COMPRESSED_BC | FORMAT_PROPERTY_COMPRESSED_EAC | FORMAT_PROPERTY_COMPRESSED_ETC2 | FORMAT_PROPERTY_COMPRESSED_PVRTC;
+
 // Generic information for all formats
 struct FORMAT_INFO {
+    VkFormat format;
     FORMAT_COMPATIBILITY_CLASS compatibility;
     uint32_t block_size; // bytes
     uint32_t texel_per_block;
     VkExtent3D block_extent;
     uint32_t component_count;
     COMPONENT_INFO components[FORMAT_MAX_COMPONENTS];
+    FORMAT_NUMERICAL_TYPE numerical_type; // NONE if the components have different numerical types
+    uint32_t properties; // FORMAT_PROPERTY_BITS
+    uint32_t plane_count;
+    uint32_t depth_size; // bits
+    FORMAT_NUMERICAL_TYPE depth_numerical_type;
+    uint32_t stencil_size; // bits
+    FORMAT_NUMERICAL_TYPE stencil_numerical_type;
+};
+
+// VK_FORMAT_UNDEFINED must stay the first entry, it is returned for any unknown format
+// clang-format off
+static constexpr FORMAT_INFO kVkFormatTable[] = {
+    {VK_FORMAT_UNDEFINED, FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {},
+        FORMAT_NUMERICAL_TYPE::NONE, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A1R5G5B5_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 1}, {COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::B, 5}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_SINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::SINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_SNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::SNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_SSCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_UINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_UNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2B10G10R10_USCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::USCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_SINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::SINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_SNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::SNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_SSCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_UINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::UINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_UNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A2R10G10B10_USCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}},
+        FORMAT_NUMERICAL_TYPE::USCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A4B4G4R4_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 4}, {COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::R, 4}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A4R4G4B4_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 4}, {COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::B, 4}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_SINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_SNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_SRGB_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_SSCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_UINT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_UNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_A8B8G8R8_USCALED_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x10_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x5_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x6_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_10x8_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x10_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_12x12_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_4x4_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x4_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_5x5_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x5_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_6x6_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x5_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x6_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_ASTC_HDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ASTC_8x8_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ASTC_LDR, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B10G11R11_UFLOAT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 11}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UFLOAT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_B10G10R10G10, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_B12G12R12G12, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B16G16R16G16_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_64BIT_B16G16R16G16, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B4G4R4A4_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::A, 4}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B5G5R5A1_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::A, 1}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B5G6R5_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::G, 6}, {COMPONENT_TYPE::R, 5}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_SINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_SNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_SRGB, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_UINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_UNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8A8_USCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8G8_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT_B8G8R8G8, 4, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_SINT, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_SNORM, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_SRGB, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_UINT, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_UNORM, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_B8G8R8_USCALED, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC1_RGBA, 8, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC1_RGBA_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC1_RGBA, 8, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC1_RGB_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC1_RGB, 8, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC1_RGB_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC1_RGB, 8, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC2_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC2, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC2_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC2, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC3_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC3, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC3_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC3, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC4_SNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC4, 8, 16, {4, 4, 1}, 1,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC4_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC4, 8, 16, {4, 4, 1}, 1,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC5_SNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC5, 16, 16, {4, 4, 1}, 2,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC5_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC5, 16, 16, {4, 4, 1}, 2,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC6H_SFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC6H, 16, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC6H_UFLOAT_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC6H, 16, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UFLOAT, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC7_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC7, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_BC7_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::BC7, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_BC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_D16_UNORM, FORMAT_COMPATIBILITY_CLASS::D16, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::D, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 16, FORMAT_NUMERICAL_TYPE::UNORM, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_D16_UNORM_S8_UINT, FORMAT_COMPATIBILITY_CLASS::D16S8, 3, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::D, 16}, {COMPONENT_TYPE::S, 8}},
+        FORMAT_NUMERICAL_TYPE::NONE, 0, 1, 16, FORMAT_NUMERICAL_TYPE::UNORM, 8, FORMAT_NUMERICAL_TYPE::UINT},
+    {VK_FORMAT_D24_UNORM_S8_UINT, FORMAT_COMPATIBILITY_CLASS::D24S8, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::D, 24}, {COMPONENT_TYPE::S, 8}},
+        FORMAT_NUMERICAL_TYPE::NONE, 0, 1, 24, FORMAT_NUMERICAL_TYPE::UNORM, 8, FORMAT_NUMERICAL_TYPE::UINT},
+    {VK_FORMAT_D32_SFLOAT, FORMAT_COMPATIBILITY_CLASS::D32, 4, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::D, 32}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 32, FORMAT_NUMERICAL_TYPE::SFLOAT, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_D32_SFLOAT_S8_UINT, FORMAT_COMPATIBILITY_CLASS::D32S8, 5, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::D, 32}, {COMPONENT_TYPE::S, 8}},
+        FORMAT_NUMERICAL_TYPE::NONE, 0, 1, 32, FORMAT_NUMERICAL_TYPE::SFLOAT, 8, FORMAT_NUMERICAL_TYPE::UINT},
+    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::B, 9}, {COMPONENT_TYPE::G, 9}, {COMPONENT_TYPE::R, 9}},
+        FORMAT_NUMERICAL_TYPE::UFLOAT, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::EAC_RG, 16, 16, {4, 4, 1}, 2,
+        {{COMPONENT_TYPE::R, 11}, {COMPONENT_TYPE::G, 11}},
+        FORMAT_NUMERICAL_TYPE::SNORM, FORMAT_PROPERTY_COMPRESSED_EAC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_EAC_R11G11_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::EAC_RG, 16, 16, {4, 4, 1}, 2,
+        {{COMPONENT_TYPE::R, 11}, {COMPONENT_TYPE::G, 11}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_EAC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_EAC_R11_SNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::EAC_R, 8, 16, {4, 4, 1}, 1,
+        {{COMPONENT_TYPE::R, 11}},
+        FORMAT_NUMERICAL_TYPE::SNORM, FORMAT_PROPERTY_COMPRESSED_EAC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_EAC_R11_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::EAC_R, 8, 16, {4, 4, 1}, 1,
+        {{COMPONENT_TYPE::R, 11}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_EAC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_RGBA, 8, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_RGBA, 8, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_EAC_RGBA, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_EAC_RGBA, 16, 16, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_RGB, 8, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, FORMAT_COMPATIBILITY_CLASS::ETC2_RGB, 8, 16, {4, 4, 1}, 3,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_ETC2, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_G10B10G10R10, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_G12B12G12R12, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16, FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16B16G16R16_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_64BIT_G16B16G16R16, 8, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16R16_2PLANE_420_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16R16_2PLANE_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16R16_2PLANE_444_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8B8G8R8_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT_G8B8G8R8, 4, 1, {2, 1, 1}, 4,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_SINGLE_PLANE_422, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8R8_2PLANE_420_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_420, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8R8_2PLANE_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_422, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8R8_2PLANE_444_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_444, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION, 2, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_420, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED | FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_422, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION | FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_444, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_YCBCR_CONVERSION, 3, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC1_2BPP, 8, 1, {8, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC1_2BPP, 8, 1, {8, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC1_4BPP, 8, 1, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC1_4BPP, 8, 1, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC2_2BPP, 8, 1, {8, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC2_2BPP, 8, 1, {8, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC2_4BPP, 8, 1, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::SRGB, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG, FORMAT_COMPATIBILITY_CLASS::PVRTC2_4BPP, 8, 1, {4, 4, 1}, 4,
+        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_COMPRESSED_PVRTC, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_R10G10B10A10, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::A, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R10X6G10X6_UNORM_2PACK16, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R10X6_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 10}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16, FORMAT_COMPATIBILITY_CLASS::_64BIT_R12G12B12A12, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::A, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED | FORMAT_PROPERTY_YCBCR_CONVERSION, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R12X4G12X4_UNORM_2PACK16, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R12X4_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 12}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_SINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_SNORM, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_SSCALED, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_UINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_UNORM, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16A16_USCALED, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_SINT, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_SNORM, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_SSCALED, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_UINT, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_UNORM, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16B16_USCALED, FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_S10_5_NV, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_SINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_SNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_SSCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_UINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_UNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16G16_USCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_SINT, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_SNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_SSCALED, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_UINT, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R16_USCALED, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 16}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32A32_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32A32_SINT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32A32_UINT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32_SINT, FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32B32_UINT, FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32_SINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32G32_UINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 32}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32_SINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 32}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R32_UINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 32}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R4G4B4A4_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::A, 4}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R4G4_UNORM_PACK8, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R5G5B5A1_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::A, 1}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R5G6B5_UNORM_PACK16, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 6}, {COMPONENT_TYPE::B, 5}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64A64_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64A64_SINT, FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64A64_UINT, FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64_SINT, FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64B64_UINT, FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64_SINT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64G64_UINT, FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64_SFLOAT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 64}},
+        FORMAT_NUMERICAL_TYPE::SFLOAT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64_SINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 64}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R64_UINT, FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 64}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_SINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_SNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_SRGB, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_UINT, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_UNORM, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8A8_USCALED, FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_SINT, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_SNORM, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_SRGB, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_UINT, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_UNORM, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8B8_USCALED, FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_SINT, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_SNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_SRGB, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_UINT, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_UNORM, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8G8_USCALED, FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
+        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_SINT, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_SNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_SRGB, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SRGB, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_SSCALED, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::SSCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_UINT, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_UNORM, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::UNORM, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_R8_USCALED, FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::R, 8}},
+        FORMAT_NUMERICAL_TYPE::USCALED, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
+    {VK_FORMAT_S8_UINT, FORMAT_COMPATIBILITY_CLASS::S8, 1, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::S, 8}},
+        FORMAT_NUMERICAL_TYPE::UINT, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 8, FORMAT_NUMERICAL_TYPE::UINT},
+    {VK_FORMAT_X8_D24_UNORM_PACK32, FORMAT_COMPATIBILITY_CLASS::D24, 4, 1, {1, 1, 1}, 1,
+        {{COMPONENT_TYPE::D, 24}},
+        FORMAT_NUMERICAL_TYPE::UNORM, FORMAT_PROPERTY_PACKED, 1, 24, FORMAT_NUMERICAL_TYPE::UNORM, 0, FORMAT_NUMERICAL_TYPE::NONE},
 };
+// clang-format on
+static_assert(kVkFormatTable[0].format == VK_FORMAT_UNDEFINED, "First format table entry must be VK_FORMAT_UNDEFINED");
+static_assert(std::size(kVkFormatTable) <= std::numeric_limits<uint16_t>::max(), "Format table index does not fit in uint16_t");
+
+// Formats before the first extension enum block (core 1.0 formats) are indexed directly by their enum value
+static constexpr uint32_t kExtensionFormatBase = 1000000000;
+
+static constexpr uint32_t CoreFormatCount() {
+    uint32_t count = 0;
+    for (const FORMAT_INFO &info : kVkFormatTable) {
+        const uint32_t value = static_cast<uint32_t>(info.format);
+        if (value < kExtensionFormatBase && value >= count) {
+            count = value + 1;
+        }
+    }
+    return count;
+}
+static constexpr uint32_t kCoreFormatCount = CoreFormatCount();
+
+// Holes in the core range map to index 0 (VK_FORMAT_UNDEFINED)
+static constexpr std::array<uint16_t, kCoreFormatCount> BuildCoreFormatIndex() {
+    std::array<uint16_t, kCoreFormatCount> index = {};
+    for (uint16_t i = 0; i < std::size(kVkFormatTable); ++i) {
+        const uint32_t value = static_cast<uint32_t>(kVkFormatTable[i].format);
+        if (value < kCoreFormatCount) {
+            index[value] = i;
+        }
+    }
+    return index;
+}
+static constexpr std::array<uint16_t, kCoreFormatCount> kCoreFormatIndex = BuildCoreFormatIndex();
+
+// Extension formats are found with a perfect hash (format % size), the size is the smallest one without collisions
+static constexpr uint32_t kMaxExtensionFormatHashSize = 1024;
+
+static constexpr uint32_t ExtensionFormatHashSize() {
+    // Each slot remembers the last hash size that claimed it, so it never needs to be cleared
+    std::array<uint32_t, kMaxExtensionFormatHashSize> claimed = {};
+    for (uint32_t size = 1; size <= kMaxExtensionFormatHashSize; ++size) {
+        bool collision = false;
+        for (const FORMAT_INFO &info : kVkFormatTable) {
+            const uint32_t value = static_cast<uint32_t>(info.format);
+            if (value < kExtensionFormatBase) {
+                continue;
+            }
+            if (claimed[value % size] == size) {
+                collision = true;
+                break;
+            }
+            claimed[value % size] = size;
+        }
+        if (!collision) {
+            return size;
+        }
+    }
+    return 0;
+}
+static constexpr uint32_t kExtensionFormatHashSize = ExtensionFormatHashSize();
+static_assert(kExtensionFormatHashSize != 0, "No perfect hash for the extension formats, increase kMaxExtensionFormatHashSize");
+
+static constexpr std::array<uint16_t, kExtensionFormatHashSize> BuildExtensionFormatIndex() {
+    std::array<uint16_t, kExtensionFormatHashSize> index = {};
+    for (uint16_t i = 0; i < std::size(kVkFormatTable); ++i) {
+        const uint32_t value = static_cast<uint32_t>(kVkFormatTable[i].format);
+        if (value >= kExtensionFormatBase) {
+            index[value % kExtensionFormatHashSize] = i;
+        }
+    }
+    return index;
+}
+static constexpr std::array<uint16_t, kExtensionFormatHashSize> kExtensionFormatIndex = BuildExtensionFormatIndex();
+
+// Returns the VK_FORMAT_UNDEFINED entry if the format is unknown
+static constexpr const FORMAT_INFO &GetFormatInfo(VkFormat format) {
+    const uint32_t value = static_cast<uint32_t>(format);
+    if (value < kCoreFormatCount) {
+        return kVkFormatTable[kCoreFormatIndex[value]];
+    }
+    const FORMAT_INFO &info = kVkFormatTable[kExtensionFormatIndex[value % kExtensionFormatHashSize]];
+    return (info.format == format) ? info : kVkFormatTable[0];
+}
+
+static_assert(GetFormatInfo(VK_FORMAT_R8G8B8A8_UNORM).format == VK_FORMAT_R8G8B8A8_UNORM, "Core format lookup is broken");
+static_assert(GetFormatInfo(VK_FORMAT_G8_B8R8_2PLANE_420_UNORM).format == VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
+              "Extension format lookup is broken");
+static_assert(GetFormatInfo(VK_FORMAT_MAX_ENUM).format == VK_FORMAT_UNDEFINED, "Unknown format lookup is broken");
 
 namespace std {
 template <>
@@ -66,752 +927,6 @@ struct hash<VkFormat> {
 };
 }
 
-// clang-format off
-static const vvl::unordered_map<VkFormat, FORMAT_INFO> kVkFormatTable = {
-    {VK_FORMAT_A1R5G5B5_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 1}, {COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::B, 5}} }},
-    {VK_FORMAT_A2B10G10R10_SINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2B10G10R10_SNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2B10G10R10_SSCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2B10G10R10_UINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2B10G10R10_UNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2B10G10R10_USCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_A2R10G10B10_SINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A2R10G10B10_SNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A2R10G10B10_SSCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A2R10G10B10_UINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A2R10G10B10_UNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A2R10G10B10_USCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 2}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}} }},
-    {VK_FORMAT_A4B4G4R4_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 4}, {COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::R, 4}} }},
-    {VK_FORMAT_A4R4G4B4_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 4}, {COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::B, 4}} }},
-    {VK_FORMAT_A8B8G8R8_SINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_SNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_SRGB_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_SSCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_UINT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_UNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_A8B8G8R8_USCALED_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::A, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x10_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X10, 16, 100, {10, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x5_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X5, 16, 50, {10, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x6_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X6, 16, 60, {10, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_10x8_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_10X8, 16, 80, {10, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x10_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X10, 16, 120, {12, 10, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_12x12_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_12X12, 16, 144, {12, 12, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_4x4_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_4X4, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x4_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X4, 16, 20, {5, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_5x5_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_5X5, 16, 25, {5, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x5_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X5, 16, 30, {6, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_6x6_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_6X6, 16, 36, {6, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x5_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X5, 16, 40, {8, 5, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x6_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X6, 16, 48, {8, 6, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ASTC_8x8_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ASTC_8X8, 16, 64, {8, 8, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_B10G11R11_UFLOAT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 11}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_B10G10R10G10, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}} }},
-    {VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_B12G12R12G12, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}} }},
-    {VK_FORMAT_B16G16R16G16_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_B16G16R16G16, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_B4G4R4A4_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::A, 4}} }},
-    {VK_FORMAT_B5G5R5A1_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::A, 1}} }},
-    {VK_FORMAT_B5G6R5_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::G, 6}, {COMPONENT_TYPE::R, 5}} }},
-    {VK_FORMAT_B8G8R8A8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8A8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_B8G8R8G8_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT_B8G8R8G8, 4, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_B8G8R8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_B8G8R8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC1_RGBA, 8, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC1_RGBA_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC1_RGBA, 8, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC1_RGB_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC1_RGB, 8, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC1_RGB_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC1_RGB, 8, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC2_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC2, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC2_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC2, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC3_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC3, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC3_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC3, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC4_SNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC4, 8, 16, {4, 4, 1}, 1,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC4_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC4, 8, 16, {4, 4, 1}, 1,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC5_SNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC5, 16, 16, {4, 4, 1}, 2,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC5_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC5, 16, 16, {4, 4, 1}, 2,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC6H_SFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC6H, 16, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC6H_UFLOAT_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC6H, 16, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC7_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC7, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_BC7_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::BC7, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_D16_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::D16, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::D, 16}} }},
-    {VK_FORMAT_D16_UNORM_S8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::D16S8, 3, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::D, 16}, {COMPONENT_TYPE::S, 8}} }},
-    {VK_FORMAT_D24_UNORM_S8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::D24S8, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::D, 24}, {COMPONENT_TYPE::S, 8}} }},
-    {VK_FORMAT_D32_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::D32, 4, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::D, 32}} }},
-    {VK_FORMAT_D32_SFLOAT_S8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::D32S8, 5, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::D, 32}, {COMPONENT_TYPE::S, 8}} }},
-    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::B, 9}, {COMPONENT_TYPE::G, 9}, {COMPONENT_TYPE::R, 9}} }},
-    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::EAC_RG, 16, 16, {4, 4, 1}, 2,
-        {{COMPONENT_TYPE::R, 11}, {COMPONENT_TYPE::G, 11}} }},
-    {VK_FORMAT_EAC_R11G11_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::EAC_RG, 16, 16, {4, 4, 1}, 2,
-        {{COMPONENT_TYPE::R, 11}, {COMPONENT_TYPE::G, 11}} }},
-    {VK_FORMAT_EAC_R11_SNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::EAC_R, 8, 16, {4, 4, 1}, 1,
-        {{COMPONENT_TYPE::R, 11}} }},
-    {VK_FORMAT_EAC_R11_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::EAC_R, 8, 16, {4, 4, 1}, 1,
-        {{COMPONENT_TYPE::R, 11}} }},
-    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_RGBA, 8, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_RGBA, 8, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_EAC_RGBA, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_EAC_RGBA, 16, 16, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_RGB, 8, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK,
-        {FORMAT_COMPATIBILITY_CLASS::ETC2_RGB, 8, 16, {4, 4, 1}, 3,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_G10B10G10R10, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_10BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_G12B12G12R12, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_12BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_G16B16G16R16_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_G16B16G16R16, 8, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16R16_2PLANE_444_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_2PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_420, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_422, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT_3PLANE_444, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_G8B8G8R8_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT_G8B8G8R8, 4, 1, {2, 1, 1}, 4,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_420, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_422, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8R8_2PLANE_444_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_2PLANE_444, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_420, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_422, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT_3PLANE_444, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC1_2BPP, 8, 1, {8, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC1_2BPP, 8, 1, {8, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC1_4BPP, 8, 1, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC1_4BPP, 8, 1, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC2_2BPP, 8, 1, {8, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC2_2BPP, 8, 1, {8, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC2_4BPP, 8, 1, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG,
-        {FORMAT_COMPATIBILITY_CLASS::PVRTC2_4BPP, 8, 1, {4, 4, 1}, 4,
-        {{COMPONENT_TYPE::R, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::G, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::B, COMPRESSED_COMPONENT}, {COMPONENT_TYPE::A, COMPRESSED_COMPONENT}} }},
-    {VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_R10G10B10A10, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}, {COMPONENT_TYPE::B, 10}, {COMPONENT_TYPE::A, 10}} }},
-    {VK_FORMAT_R10X6G10X6_UNORM_2PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 10}, {COMPONENT_TYPE::G, 10}} }},
-    {VK_FORMAT_R10X6_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 10}} }},
-    {VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT_R12G12B12A12, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}, {COMPONENT_TYPE::B, 12}, {COMPONENT_TYPE::A, 12}} }},
-    {VK_FORMAT_R12X4G12X4_UNORM_2PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 12}, {COMPONENT_TYPE::G, 12}} }},
-    {VK_FORMAT_R12X4_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 12}} }},
-    {VK_FORMAT_R16G16B16A16_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16A16_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}, {COMPONENT_TYPE::A, 16}} }},
-    {VK_FORMAT_R16G16B16_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16B16_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_48BIT, 6, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}, {COMPONENT_TYPE::B, 16}} }},
-    {VK_FORMAT_R16G16_S10_5_NV,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16G16_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 16}, {COMPONENT_TYPE::G, 16}} }},
-    {VK_FORMAT_R16_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R16_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 16}} }},
-    {VK_FORMAT_R32G32B32A32_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}} }},
-    {VK_FORMAT_R32G32B32A32_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}} }},
-    {VK_FORMAT_R32G32B32A32_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}, {COMPONENT_TYPE::A, 32}} }},
-    {VK_FORMAT_R32G32B32_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}} }},
-    {VK_FORMAT_R32G32B32_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}} }},
-    {VK_FORMAT_R32G32B32_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_96BIT, 12, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}, {COMPONENT_TYPE::B, 32}} }},
-    {VK_FORMAT_R32G32_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}} }},
-    {VK_FORMAT_R32G32_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}} }},
-    {VK_FORMAT_R32G32_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 32}, {COMPONENT_TYPE::G, 32}} }},
-    {VK_FORMAT_R32_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 32}} }},
-    {VK_FORMAT_R32_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 32}} }},
-    {VK_FORMAT_R32_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 32}} }},
-    {VK_FORMAT_R4G4B4A4_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}, {COMPONENT_TYPE::B, 4}, {COMPONENT_TYPE::A, 4}} }},
-    {VK_FORMAT_R4G4_UNORM_PACK8,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 4}, {COMPONENT_TYPE::G, 4}} }},
-    {VK_FORMAT_R5G5B5A1_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::B, 5}, {COMPONENT_TYPE::A, 1}} }},
-    {VK_FORMAT_R5G6B5_UNORM_PACK16,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 6}, {COMPONENT_TYPE::B, 5}} }},
-    {VK_FORMAT_R64G64B64A64_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}} }},
-    {VK_FORMAT_R64G64B64A64_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}} }},
-    {VK_FORMAT_R64G64B64A64_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_256BIT, 32, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}, {COMPONENT_TYPE::A, 64}} }},
-    {VK_FORMAT_R64G64B64_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64G64B64_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64G64B64_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_192BIT, 24, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::G, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64G64_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64G64_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64G64_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_128BIT, 16, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 64}, {COMPONENT_TYPE::B, 64}} }},
-    {VK_FORMAT_R64_SFLOAT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 64}} }},
-    {VK_FORMAT_R64_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 64}} }},
-    {VK_FORMAT_R64_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_64BIT, 8, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 64}} }},
-    {VK_FORMAT_R8G8B8A8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8A8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_32BIT, 4, 1, {1, 1, 1}, 4,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}, {COMPONENT_TYPE::A, 8}} }},
-    {VK_FORMAT_R8G8B8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8B8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_24BIT, 3, 1, {1, 1, 1}, 3,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}, {COMPONENT_TYPE::B, 8}} }},
-    {VK_FORMAT_R8G8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8G8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 2,
-        {{COMPONENT_TYPE::R, 8}, {COMPONENT_TYPE::G, 8}} }},
-    {VK_FORMAT_R8_SINT,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_SNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_SRGB,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_SSCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_UNORM,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_R8_USCALED,
-        {FORMAT_COMPATIBILITY_CLASS::_8BIT, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::R, 8}} }},
-    {VK_FORMAT_S8_UINT,
-        {FORMAT_COMPATIBILITY_CLASS::S8, 1, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::S, 8}} }},
-    {VK_FORMAT_X8_D24_UNORM_PACK32,
-        {FORMAT_COMPATIBILITY_CLASS::D24, 4, 1, {1, 1, 1}, 1,
-        {{COMPONENT_TYPE::D, 24}} }},
-    {VK_FORMAT_UNDEFINED, {FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {}}}};
-// clang-format on
-
 struct PER_PLANE_COMPATIBILITY {
     uint32_t width_divisor;
     uint32_t height_divisor;
@@ -947,865 +1062,152 @@ static const vvl::unordered_map<VkFormat, MULTIPLANE_COMPATIBILITY> kVkMultiplan
 
 // Return true if all components in the format are an UNORM
 bool FormatIsUNORM(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R4G4_UNORM_PACK8:
-        case VK_FORMAT_R4G4B4A4_UNORM_PACK16:
-        case VK_FORMAT_B4G4R4A4_UNORM_PACK16:
-        case VK_FORMAT_R5G6B5_UNORM_PACK16:
-        case VK_FORMAT_B5G6R5_UNORM_PACK16:
-        case VK_FORMAT_R5G5B5A1_UNORM_PACK16:
-        case VK_FORMAT_B5G5R5A1_UNORM_PACK16:
-        case VK_FORMAT_A1R5G5B5_UNORM_PACK16:
-        case VK_FORMAT_R8_UNORM:
-        case VK_FORMAT_R8G8_UNORM:
-        case VK_FORMAT_R8G8B8_UNORM:
-        case VK_FORMAT_B8G8R8_UNORM:
-        case VK_FORMAT_R8G8B8A8_UNORM:
-        case VK_FORMAT_B8G8R8A8_UNORM:
-        case VK_FORMAT_A8B8G8R8_UNORM_PACK32:
-        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
-        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
-        case VK_FORMAT_R16_UNORM:
-        case VK_FORMAT_R16G16_UNORM:
-        case VK_FORMAT_R16G16B16_UNORM:
-        case VK_FORMAT_R16G16B16A16_UNORM:
-        case VK_FORMAT_D16_UNORM:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
-        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
-        case VK_FORMAT_BC2_UNORM_BLOCK:
-        case VK_FORMAT_BC3_UNORM_BLOCK:
-        case VK_FORMAT_BC4_UNORM_BLOCK:
-        case VK_FORMAT_BC5_UNORM_BLOCK:
-        case VK_FORMAT_BC7_UNORM_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
-        case VK_FORMAT_EAC_R11_UNORM_BLOCK:
-        case VK_FORMAT_EAC_R11G11_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_5x4_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_5x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_6x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x8_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x10_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_12x10_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_12x12_UNORM_BLOCK:
-        case VK_FORMAT_G8B8G8R8_422_UNORM:
-        case VK_FORMAT_B8G8R8G8_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM:
-        case VK_FORMAT_R10X6_UNORM_PACK16:
-        case VK_FORMAT_R10X6G10X6_UNORM_2PACK16:
-        case VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16:
-        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_R12X4_UNORM_PACK16:
-        case VK_FORMAT_R12X4G12X4_UNORM_2PACK16:
-        case VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16:
-        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16B16G16R16_422_UNORM:
-        case VK_FORMAT_B16G16R16G16_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM:
-        case VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_G8_B8R8_2PLANE_444_UNORM:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16R16_2PLANE_444_UNORM:
-        case VK_FORMAT_A4R4G4B4_UNORM_PACK16:
-        case VK_FORMAT_A4B4G4R4_UNORM_PACK16:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::UNORM;
 }
 
 // Return true if all components in the format are an SNORM
 bool FormatIsSNORM(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_SNORM:
-        case VK_FORMAT_R8G8_SNORM:
-        case VK_FORMAT_R8G8B8_SNORM:
-        case VK_FORMAT_B8G8R8_SNORM:
-        case VK_FORMAT_R8G8B8A8_SNORM:
-        case VK_FORMAT_B8G8R8A8_SNORM:
-        case VK_FORMAT_A8B8G8R8_SNORM_PACK32:
-        case VK_FORMAT_A2R10G10B10_SNORM_PACK32:
-        case VK_FORMAT_A2B10G10R10_SNORM_PACK32:
-        case VK_FORMAT_R16_SNORM:
-        case VK_FORMAT_R16G16_SNORM:
-        case VK_FORMAT_R16G16B16_SNORM:
-        case VK_FORMAT_R16G16B16A16_SNORM:
-        case VK_FORMAT_EAC_R11_SNORM_BLOCK:
-        case VK_FORMAT_EAC_R11G11_SNORM_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::SNORM;
 }
 
 // Return true if all components in the format are an USCALED
 bool FormatIsUSCALED(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_USCALED:
-        case VK_FORMAT_R8G8_USCALED:
-        case VK_FORMAT_R8G8B8_USCALED:
-        case VK_FORMAT_B8G8R8_USCALED:
-        case VK_FORMAT_R8G8B8A8_USCALED:
-        case VK_FORMAT_B8G8R8A8_USCALED:
-        case VK_FORMAT_A8B8G8R8_USCALED_PACK32:
-        case VK_FORMAT_A2R10G10B10_USCALED_PACK32:
-        case VK_FORMAT_A2B10G10R10_USCALED_PACK32:
-        case VK_FORMAT_R16_USCALED:
-        case VK_FORMAT_R16G16_USCALED:
-        case VK_FORMAT_R16G16B16_USCALED:
-        case VK_FORMAT_R16G16B16A16_USCALED:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::USCALED;
 }
 
 // Return true if all components in the format are an SSCALED
 bool FormatIsSSCALED(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_SSCALED:
-        case VK_FORMAT_R8G8_SSCALED:
-        case VK_FORMAT_R8G8B8_SSCALED:
-        case VK_FORMAT_B8G8R8_SSCALED:
-        case VK_FORMAT_R8G8B8A8_SSCALED:
-        case VK_FORMAT_B8G8R8A8_SSCALED:
-        case VK_FORMAT_A8B8G8R8_SSCALED_PACK32:
-        case VK_FORMAT_A2R10G10B10_SSCALED_PACK32:
-        case VK_FORMAT_A2B10G10R10_SSCALED_PACK32:
-        case VK_FORMAT_R16_SSCALED:
-        case VK_FORMAT_R16G16_SSCALED:
-        case VK_FORMAT_R16G16B16_SSCALED:
-        case VK_FORMAT_R16G16B16A16_SSCALED:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::SSCALED;
 }
 
 // Return true if all components in the format are an UINT
 bool FormatIsUINT(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_UINT:
-        case VK_FORMAT_R8G8_UINT:
-        case VK_FORMAT_R8G8B8_UINT:
-        case VK_FORMAT_B8G8R8_UINT:
-        case VK_FORMAT_R8G8B8A8_UINT:
-        case VK_FORMAT_B8G8R8A8_UINT:
-        case VK_FORMAT_A8B8G8R8_UINT_PACK32:
-        case VK_FORMAT_A2R10G10B10_UINT_PACK32:
-        case VK_FORMAT_A2B10G10R10_UINT_PACK32:
-        case VK_FORMAT_R16_UINT:
-        case VK_FORMAT_R16G16_UINT:
-        case VK_FORMAT_R16G16B16_UINT:
-        case VK_FORMAT_R16G16B16A16_UINT:
-        case VK_FORMAT_R32_UINT:
-        case VK_FORMAT_R32G32_UINT:
-        case VK_FORMAT_R32G32B32_UINT:
-        case VK_FORMAT_R32G32B32A32_UINT:
-        case VK_FORMAT_R64_UINT:
-        case VK_FORMAT_R64G64_UINT:
-        case VK_FORMAT_R64G64B64_UINT:
-        case VK_FORMAT_R64G64B64A64_UINT:
-        case VK_FORMAT_S8_UINT:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::UINT;
 }
 
 // Return true if all components in the format are an SINT
 bool FormatIsSINT(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_SINT:
-        case VK_FORMAT_R8G8_SINT:
-        case VK_FORMAT_R8G8B8_SINT:
-        case VK_FORMAT_B8G8R8_SINT:
-        case VK_FORMAT_R8G8B8A8_SINT:
-        case VK_FORMAT_B8G8R8A8_SINT:
-        case VK_FORMAT_A8B8G8R8_SINT_PACK32:
-        case VK_FORMAT_A2R10G10B10_SINT_PACK32:
-        case VK_FORMAT_A2B10G10R10_SINT_PACK32:
-        case VK_FORMAT_R16_SINT:
-        case VK_FORMAT_R16G16_SINT:
-        case VK_FORMAT_R16G16B16_SINT:
-        case VK_FORMAT_R16G16B16A16_SINT:
-        case VK_FORMAT_R32_SINT:
-        case VK_FORMAT_R32G32_SINT:
-        case VK_FORMAT_R32G32B32_SINT:
-        case VK_FORMAT_R32G32B32A32_SINT:
-        case VK_FORMAT_R64_SINT:
-        case VK_FORMAT_R64G64_SINT:
-        case VK_FORMAT_R64G64B64_SINT:
-        case VK_FORMAT_R64G64B64A64_SINT:
-        case VK_FORMAT_R16G16_S10_5_NV:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::SINT;
 }
 
 // Return true if all components in the format are an SRGB
 bool FormatIsSRGB(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R8_SRGB:
-        case VK_FORMAT_R8G8_SRGB:
-        case VK_FORMAT_R8G8B8_SRGB:
-        case VK_FORMAT_B8G8R8_SRGB:
-        case VK_FORMAT_R8G8B8A8_SRGB:
-        case VK_FORMAT_B8G8R8A8_SRGB:
-        case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
-        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
-        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
-        case VK_FORMAT_BC2_SRGB_BLOCK:
-        case VK_FORMAT_BC3_SRGB_BLOCK:
-        case VK_FORMAT_BC4_SNORM_BLOCK:
-        case VK_FORMAT_BC5_SNORM_BLOCK:
-        case VK_FORMAT_BC7_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_5x4_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_5x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_6x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x8_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x10_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_12x10_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_12x12_SRGB_BLOCK:
-        case VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::SRGB;
 }
 
 // Return true if all components in the format are an SFLOAT
 bool FormatIsSFLOAT(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R16_SFLOAT:
-        case VK_FORMAT_R16G16_SFLOAT:
-        case VK_FORMAT_R16G16B16_SFLOAT:
-        case VK_FORMAT_R16G16B16A16_SFLOAT:
-        case VK_FORMAT_R32_SFLOAT:
-        case VK_FORMAT_R32G32_SFLOAT:
-        case VK_FORMAT_R32G32B32_SFLOAT:
-        case VK_FORMAT_R32G32B32A32_SFLOAT:
-        case VK_FORMAT_R64_SFLOAT:
-        case VK_FORMAT_R64G64_SFLOAT:
-        case VK_FORMAT_R64G64B64_SFLOAT:
-        case VK_FORMAT_R64G64B64A64_SFLOAT:
-        case VK_FORMAT_D32_SFLOAT:
-        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::SFLOAT;
 }
 
 // Return true if all components in the format are an UFLOAT
 bool FormatIsUFLOAT(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
-        case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
-        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::UFLOAT;
 }
 
 
 // Return true if the format is a ASTC_HDR compressed image format
 bool FormatIsCompressed_ASTC_HDR(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK:
-        case VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_ASTC_HDR) != 0;
 }
 
 // Return true if the format is a ASTC_LDR compressed image format
 bool FormatIsCompressed_ASTC_LDR(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_ASTC_10x10_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x10_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_10x8_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_10x8_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_12x10_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_12x10_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_12x12_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_12x12_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_5x4_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_5x4_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_5x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_5x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_6x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_6x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x5_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x5_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x6_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x6_UNORM_BLOCK:
-        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
-        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_ASTC_LDR) != 0;
 }
 
 // Return true if the format is a BC compressed image format
 bool FormatIsCompressed_BC(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
-        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
-        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
-        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
-        case VK_FORMAT_BC2_SRGB_BLOCK:
-        case VK_FORMAT_BC2_UNORM_BLOCK:
-        case VK_FORMAT_BC3_SRGB_BLOCK:
-        case VK_FORMAT_BC3_UNORM_BLOCK:
-        case VK_FORMAT_BC4_SNORM_BLOCK:
-        case VK_FORMAT_BC4_UNORM_BLOCK:
-        case VK_FORMAT_BC5_SNORM_BLOCK:
-        case VK_FORMAT_BC5_UNORM_BLOCK:
-        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
-        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
-        case VK_FORMAT_BC7_SRGB_BLOCK:
-        case VK_FORMAT_BC7_UNORM_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_BC) != 0;
 }
 
 // Return true if the format is a EAC compressed image format
 bool FormatIsCompressed_EAC(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_EAC_R11G11_SNORM_BLOCK:
-        case VK_FORMAT_EAC_R11G11_UNORM_BLOCK:
-        case VK_FORMAT_EAC_R11_SNORM_BLOCK:
-        case VK_FORMAT_EAC_R11_UNORM_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_EAC) != 0;
 }
 
 // Return true if the format is a ETC2 compressed image format
 bool FormatIsCompressed_ETC2(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
-        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_ETC2) != 0;
 }
 
 // Return true if the format is a PVRTC compressed image format
 bool FormatIsCompressed_PVRTC(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG:
-        case VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_PVRTC) != 0;
 }
 
 // Return true if the format is any compressed image format
 bool FormatIsCompressed(VkFormat format) {
-    return (
-      FormatIsCompressed_ASTC_HDR(format) ||
-      FormatIsCompressed_ASTC_LDR(format) ||
-      FormatIsCompressed_BC(format) ||
-      FormatIsCompressed_EAC(format) ||
-      FormatIsCompressed_ETC2(format) ||
-      FormatIsCompressed_PVRTC(format));
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED) != 0;
 }
 
 
 // Return true if format is a depth OR stencil format
 bool FormatIsDepthOrStencil(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_D16_UNORM:
-        case VK_FORMAT_D16_UNORM_S8_UINT:
-        case VK_FORMAT_D24_UNORM_S8_UINT:
-        case VK_FORMAT_D32_SFLOAT:
-        case VK_FORMAT_D32_SFLOAT_S8_UINT:
-        case VK_FORMAT_S8_UINT:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) || (info.stencil_size != 0);
 }
 
 // Return true if format is a depth AND stencil format
 bool FormatIsDepthAndStencil(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_D16_UNORM_S8_UINT:
-        case VK_FORMAT_D24_UNORM_S8_UINT:
-        case VK_FORMAT_D32_SFLOAT_S8_UINT:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) && (info.stencil_size != 0);
 }
 
 // Return true if format is a depth ONLY format
 bool FormatIsDepthOnly(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_D16_UNORM:
-        case VK_FORMAT_D32_SFLOAT:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) && (info.stencil_size == 0);
 }
 
 // Return true if format is a stencil ONLY format
 bool FormatIsStencilOnly(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_S8_UINT:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size == 0) && (info.stencil_size != 0);
 }
 
 // Returns size of depth component in bits
 // Returns zero if no depth component
-uint32_t FormatDepthSize(VkFormat format) {
-    switch (format) {
-           case VK_FORMAT_D16_UNORM:
-           case VK_FORMAT_D16_UNORM_S8_UINT:
-            return 16;
-           case VK_FORMAT_D24_UNORM_S8_UINT:
-           case VK_FORMAT_X8_D24_UNORM_PACK32:
-            return 24;
-           case VK_FORMAT_D32_SFLOAT:
-           case VK_FORMAT_D32_SFLOAT_S8_UINT:
-            return 32;
-        default:
-            return 0;
-     }
-}
+uint32_t FormatDepthSize(VkFormat format) { return GetFormatInfo(format).depth_size; }
 
 // Returns size of stencil component in bits
 // Returns zero if no stencil component
-uint32_t FormatStencilSize(VkFormat format) {
-    switch (format) {
-           case VK_FORMAT_D16_UNORM_S8_UINT:
-           case VK_FORMAT_D24_UNORM_S8_UINT:
-           case VK_FORMAT_D32_SFLOAT_S8_UINT:
-           case VK_FORMAT_S8_UINT:
-            return 8;
-        default:
-            return 0;
-     }
-}
+uint32_t FormatStencilSize(VkFormat format) { return GetFormatInfo(format).stencil_size; }
 
 // Returns NONE if no depth component
-FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format) {
-    switch (format) {
-           case VK_FORMAT_D16_UNORM:
-           case VK_FORMAT_D16_UNORM_S8_UINT:
-           case VK_FORMAT_D24_UNORM_S8_UINT:
-           case VK_FORMAT_X8_D24_UNORM_PACK32:
-            return FORMAT_NUMERICAL_TYPE::UNORM;
-           case VK_FORMAT_D32_SFLOAT:
-           case VK_FORMAT_D32_SFLOAT_S8_UINT:
-            return FORMAT_NUMERICAL_TYPE::SFLOAT;
-        default:
-            return FORMAT_NUMERICAL_TYPE::NONE;
-     }
-}
+FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format) { return GetFormatInfo(format).depth_numerical_type; }
 
 // Returns NONE if no stencil component
-FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format) {
-    switch (format) {
-           case VK_FORMAT_D16_UNORM_S8_UINT:
-           case VK_FORMAT_D24_UNORM_S8_UINT:
-           case VK_FORMAT_D32_SFLOAT_S8_UINT:
-           case VK_FORMAT_S8_UINT:
-            return FORMAT_NUMERICAL_TYPE::UINT;
-        default:
-            return FORMAT_NUMERICAL_TYPE::NONE;
-     }
-}
+FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format) { return GetFormatInfo(format).stencil_numerical_type; }
 
 
 // Return true if format is a packed format
-bool FormatIsPacked(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_R4G4_UNORM_PACK8:
-        case VK_FORMAT_R4G4B4A4_UNORM_PACK16:
-        case VK_FORMAT_B4G4R4A4_UNORM_PACK16:
-        case VK_FORMAT_R5G6B5_UNORM_PACK16:
-        case VK_FORMAT_B5G6R5_UNORM_PACK16:
-        case VK_FORMAT_R5G5B5A1_UNORM_PACK16:
-        case VK_FORMAT_B5G5R5A1_UNORM_PACK16:
-        case VK_FORMAT_A1R5G5B5_UNORM_PACK16:
-        case VK_FORMAT_A8B8G8R8_UNORM_PACK32:
-        case VK_FORMAT_A8B8G8R8_SNORM_PACK32:
-        case VK_FORMAT_A8B8G8R8_USCALED_PACK32:
-        case VK_FORMAT_A8B8G8R8_SSCALED_PACK32:
-        case VK_FORMAT_A8B8G8R8_UINT_PACK32:
-        case VK_FORMAT_A8B8G8R8_SINT_PACK32:
-        case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
-        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
-        case VK_FORMAT_A2R10G10B10_SNORM_PACK32:
-        case VK_FORMAT_A2R10G10B10_USCALED_PACK32:
-        case VK_FORMAT_A2R10G10B10_SSCALED_PACK32:
-        case VK_FORMAT_A2R10G10B10_UINT_PACK32:
-        case VK_FORMAT_A2R10G10B10_SINT_PACK32:
-        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
-        case VK_FORMAT_A2B10G10R10_SNORM_PACK32:
-        case VK_FORMAT_A2B10G10R10_USCALED_PACK32:
-        case VK_FORMAT_A2B10G10R10_SSCALED_PACK32:
-        case VK_FORMAT_A2B10G10R10_UINT_PACK32:
-        case VK_FORMAT_A2B10G10R10_SINT_PACK32:
-        case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
-        case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        case VK_FORMAT_R10X6_UNORM_PACK16:
-        case VK_FORMAT_R10X6G10X6_UNORM_2PACK16:
-        case VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16:
-        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_R12X4_UNORM_PACK16:
-        case VK_FORMAT_R12X4G12X4_UNORM_2PACK16:
-        case VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16:
-        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_A4R4G4B4_UNORM_PACK16:
-        case VK_FORMAT_A4B4G4R4_UNORM_PACK16:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
-}
+bool FormatIsPacked(VkFormat format) { return (GetFormatInfo(format).properties & FORMAT_PROPERTY_PACKED) != 0; }
 
 
 // Return true if format requires sampler YCBCR conversion
 // for VK_IMAGE_ASPECT_COLOR_BIT image views
 // Table found in spec
 bool FormatRequiresYcbcrConversion(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_B16G16R16G16_422_UNORM:
-        case VK_FORMAT_B8G8R8G8_422_UNORM:
-        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16B16G16R16_422_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_444_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM:
-        case VK_FORMAT_G8B8G8R8_422_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_444_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM:
-        case VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16:
-        case VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_YCBCR_CONVERSION) != 0;
 }
 
 bool FormatIsXChromaSubsampled(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_B16G16R16G16_422_UNORM:
-        case VK_FORMAT_B8G8R8G8_422_UNORM:
-        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G16B16G16R16_422_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
-        case VK_FORMAT_G8B8G8R8_422_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED) != 0;
 }
 
 bool FormatIsYChromaSubsampled(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED) != 0;
 }
 
 
 // Single-plane "_422" formats are treated as 2x1 compressed (for copies)
-
 bool FormatIsSinglePlane_422(VkFormat format) {
-    bool found = false;
-    switch (format) {
-        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_B16G16R16G16_422_UNORM:
-        case VK_FORMAT_B8G8R8G8_422_UNORM:
-        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
-        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
-        case VK_FORMAT_G16B16G16R16_422_UNORM:
-        case VK_FORMAT_G8B8G8R8_422_UNORM:
-        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_SINGLE_PLANE_422) != 0;
 }
 
 // Returns number of planes in format (which is 1 by default)
-uint32_t FormatPlaneCount(VkFormat format) {
-    switch (format) {
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_444_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_444_UNORM:
-            return 2;
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM:
-            return 3;
-        default:
-            return 1;
-     }
-}
+uint32_t FormatPlaneCount(VkFormat format) { return GetFormatInfo(format).plane_count; }
 
 // Will return VK_FORMAT_UNDEFINED if given a plane aspect that doesn't exist for the format
 VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
@@ -1833,29 +1235,17 @@ VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plan
 }
 
 
-uint32_t FormatComponentCount(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.component_count;
-    }
-    return 0;
-}
+uint32_t FormatComponentCount(VkFormat format) { return GetFormatInfo(format).component_count; }
 
 VkExtent3D FormatTexelBlockExtent(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.block_extent;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    if (info.format == format) {
+        return info.block_extent;
     }
     return {1, 1, 1};
 }
 
-FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.compatibility;
-    }
-    return FORMAT_COMPATIBILITY_CLASS::NONE;
-}
+FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) { return GetFormatInfo(format).compatibility; }
 
 // Return true if format is 'normal', with one texel per format element
 bool FormatElementIsTexel(VkFormat format) {
@@ -1880,11 +1270,7 @@ uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags aspectMask) {
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.block_size;
-    }
-    return 0;
+    return GetFormatInfo(format).block_size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -1900,22 +1286,18 @@ double FormatTexelSize(VkFormat format, VkImageAspectFlags aspectMask) {
 }
 
 bool FormatHasComponentSize(VkFormat format, uint32_t size) {
-    auto item = kVkFormatTable.find(format);
-    if (item == kVkFormatTable.end()) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    if (info.format != format) {
         return false;
     }
-    const COMPONENT_INFO* begin = item->second.components;
-    const COMPONENT_INFO* end = item->second.components + FORMAT_MAX_COMPONENTS;
+    const COMPONENT_INFO* begin = info.components;
+    const COMPONENT_INFO* end = info.components + FORMAT_MAX_COMPONENTS;
     return std::find_if(begin, end, [size](const COMPONENT_INFO& info) { return info.size == size; }) != end;
 }
 
 static bool FormatHasComponentType(VkFormat format, COMPONENT_TYPE component) {
-    auto item = kVkFormatTable.find(format);
-    if (item == kVkFormatTable.end()) {
-        return false;
-    }
-    const COMPONENT_INFO* begin = item->second.components;
-    const COMPONENT_INFO* end = item->second.components + FORMAT_MAX_COMPONENTS;
+    const COMPONENT_INFO* begin = GetFormatInfo(format).components;
+    const COMPONENT_INFO* end = begin + FORMAT_MAX_COMPONENTS;
     return std::find_if(begin, end, [component](const COMPONENT_INFO& info) { return info.type == component; }) != end;
 }
 
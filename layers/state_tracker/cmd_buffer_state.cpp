@@ -132,6 +132,7 @@ void CMD_BUFFER_STATE::ResetCBState() {
     resumesRenderPassInstance = false;
     state = CB_NEW;
     command_count = 0;
+    validated_draw_state = {};
     submitCount = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
     status.reset();
@@ -1049,7 +1050,12 @@ void CMD_BUFFER_STATE::PushDescriptorSetState(VkPipelineBindPoint pipelineBindPo
 // Generic function to handle state update for all CmdDraw* type functions
 void CMD_BUFFER_STATE::UpdateDrawCmd(CMD_TYPE cmd_type) {
     has_draw_cmd = true;
+    // The draw itself doesn't change the validated state, so carry it past the draw's own command
+    const bool validated = validated_draw_state.command_count == command_count;
     UpdatePipelineState(cmd_type, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    if (validated) {
+        validated_draw_state.command_count = command_count;
+    }
 
     // Update the consumed viewport/scissor count.
     uint32_t &used = usedViewportScissorCount;
@@ -1582,7 +1588,7 @@ void CMD_BUFFER_STATE::UnbindResources() {
 bool CMD_BUFFER_STATE::RasterizationDisabled() const {
     auto pipeline = lastBound[BindPoint_Graphics].pipeline_state;
     if (pipeline) {
-        if (pipeline->IsDynamic(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT)) {
+        if (pipeline->IsDynamic(CB_DYNAMIC_RASTERIZER_DISCARD_ENABLE_SET)) {
             return rasterization_disabled;
         } else {
             return pipeline->RasterizationDisabled();
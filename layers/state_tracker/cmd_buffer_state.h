@@ -175,6 +175,13 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
 
     CB_STATE state;               // Track cmd buffer update state
     uint64_t command_count;       // Number of commands recorded. Currently only used with VK_KHR_performance_query
+    // The draw time state checks last passed at this command_count, see CoreChecks::ValidateCmdBufDrawState
+    struct ValidatedDrawState {
+        uint64_t command_count = 0;
+        const PIPELINE_STATE *pipeline = nullptr;
+        CMD_TYPE cmd_type = CMD_NONE;
+    };
+    mutable ValidatedDrawState validated_draw_state;
     uint64_t submitCount;         // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
@@ -493,6 +500,8 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
                                 uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites);
 
     void UpdateDrawCmd(CMD_TYPE cmd_type);
+    // For state used by draw time validation that is changed without going through RecordCmd()
+    void InvalidateValidatedDrawState() { validated_draw_state.pipeline = nullptr; }
     void UpdateDispatchCmd(CMD_TYPE cmd_type);
     void UpdateTraceRayCmd(CMD_TYPE cmd_type);
     void UpdatePipelineState(CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point);
@@ -571,7 +580,7 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // For given pipeline, return number of MSAA samples, or one if MSAA disabled
     VkSampleCountFlagBits GetRasterizationSamples(const PIPELINE_STATE &pipeline) const {
         VkSampleCountFlagBits rasterization_samples = VK_SAMPLE_COUNT_1_BIT;
-        if (pipeline.IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT)) {
+        if (pipeline.IsDynamic(CB_DYNAMIC_RASTERIZATION_SAMPLES_EXT_SET)) {
             rasterization_samples = dynamic_state_value.rasterization_samples;
         } else {
             const auto ms_state = pipeline.MultisampleState();
@@ -486,8 +486,9 @@ void cvdescriptorset::DescriptorSet::Destroy() {
 void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count,
                                                                   const VkWriteDescriptorSet *p_wds) {
     assert(IsPushDescriptor());
+    WriteStateCache state_cache(*state_data_);
     for (uint32_t i = 0; i < write_count; i++) {
-        PerformWriteUpdate(dev_data, &p_wds[i]);
+        PerformWriteUpdate(state_cache, &p_wds[i]);
     }
 
     push_descriptor_set_writes.clear();
@@ -499,6 +500,13 @@ void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStat
 
 // Perform write update in given update struct
 void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *update) {
+    WriteStateCache state_cache(*state_data_);
+    if (PerformWriteUpdate(state_cache, update)) {
+        Invalidate(false);
+    }
+}
+
+bool cvdescriptorset::DescriptorSet::PerformWriteUpdate(WriteStateCache &state_cache, const VkWriteDescriptorSet *update) {
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
     auto descriptors_remaining = update->descriptorCount;
     auto iter = FindDescriptor(update->dstBinding, update->dstArrayElement);
@@ -510,7 +518,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
             break;
         }
-        iter->WriteUpdate(this, state_data_, update, i, iter.CurrentBinding().IsBindless());
+        iter->WriteUpdate(this, state_cache, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
     }
     if (update->descriptorCount) {
@@ -518,10 +526,8 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         ++change_count_;
     }
 
-    if (!IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
-                                                               VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
-        Invalidate(false);
-    }
+    return !IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+                                                                  VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT));
 }
 // Perform Copy update
 void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *dev_data, const VkCopyDescriptorSet *update,
@@ -718,11 +724,46 @@ static void ReplaceStatePtr(DescriptorSet *set_state, T &dst, const T &src, bool
     }
 }
 
-void cvdescriptorset::SamplerDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+template <typename State, typename Handle>
+static std::shared_ptr<State> GetCachedState(const ValidationStateTracker &dev_data,
+                                             cvdescriptorset::WriteStateCache::Entry<State, Handle> &entry, Handle handle) {
+    if (handle != entry.handle) {
+        entry.handle = handle;
+        entry.state = dev_data.GetConstCastShared<State>(handle);
+    }
+    return entry.state;
+}
+
+std::shared_ptr<SAMPLER_STATE> cvdescriptorset::WriteStateCache::GetSampler(VkSampler sampler) {
+    return GetCachedState(dev_data_, sampler_, sampler);
+}
+
+std::shared_ptr<IMAGE_VIEW_STATE> cvdescriptorset::WriteStateCache::GetImageView(VkImageView image_view) {
+    return GetCachedState(dev_data_, image_view_, image_view);
+}
+
+std::shared_ptr<BUFFER_STATE> cvdescriptorset::WriteStateCache::GetBuffer(VkBuffer buffer) {
+    return GetCachedState(dev_data_, buffer_, buffer);
+}
+
+std::shared_ptr<BUFFER_VIEW_STATE> cvdescriptorset::WriteStateCache::GetBufferView(VkBufferView buffer_view) {
+    return GetCachedState(dev_data_, buffer_view_, buffer_view);
+}
+
+std::shared_ptr<ACCELERATION_STRUCTURE_STATE_KHR> cvdescriptorset::WriteStateCache::GetAccelerationStructure(
+    VkAccelerationStructureKHR acceleration_structure) {
+    return GetCachedState(dev_data_, acceleration_structure_, acceleration_structure);
+}
+
+std::shared_ptr<ACCELERATION_STRUCTURE_STATE> cvdescriptorset::WriteStateCache::GetAccelerationStructureNV(
+    VkAccelerationStructureNV acceleration_structure) {
+    return GetCachedState(dev_data_, acceleration_structure_nv_, acceleration_structure);
+}
+
+void cvdescriptorset::SamplerDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                      const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(update->pImageInfo[index].sampler),
-                        is_bindless);
+        ReplaceStatePtr(set_state, sampler_state_, state_cache.GetSampler(update->pImageInfo[index].sampler), is_bindless);
     }
 }
 
@@ -741,16 +782,15 @@ void cvdescriptorset::SamplerDescriptor::CopyUpdate(DescriptorSet *set_state, co
     }
 }
 
-void cvdescriptorset::ImageSamplerDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::ImageSamplerDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                           const VkWriteDescriptorSet *update, const uint32_t index,
                                                           bool is_bindless) {
     const auto &image_info = update->pImageInfo[index];
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(image_info.sampler), is_bindless);
+        ReplaceStatePtr(set_state, sampler_state_, state_cache.GetSampler(image_info.sampler), is_bindless);
     }
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                    is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, state_cache.GetImageView(image_info.imageView), is_bindless);
 }
 
 void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
@@ -770,12 +810,11 @@ void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(DescriptorSet *set_stat
     ImageDescriptor::CopyUpdate(set_state, dev_data, src, is_bindless);
 }
 
-void cvdescriptorset::ImageDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::ImageDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                    const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     const auto &image_info = update->pImageInfo[index];
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                    is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, state_cache.GetImageView(image_info.imageView), is_bindless);
 }
 
 void cvdescriptorset::ImageDescriptor::CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
@@ -801,12 +840,12 @@ void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *d
     }
 }
 
-void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                     const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     const auto &buffer_info = update->pBufferInfo[index];
     offset_ = buffer_info.offset;
     range_ = buffer_info.range;
-    auto buffer_state = dev_data->GetConstCastShared<BUFFER_STATE>(buffer_info.buffer);
+    auto buffer_state = state_cache.GetBuffer(buffer_info.buffer);
     ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
 }
 
@@ -825,9 +864,9 @@ void cvdescriptorset::BufferDescriptor::CopyUpdate(DescriptorSet *set_state, con
     ReplaceStatePtr(set_state, buffer_state_, buff_desc->buffer_state_, is_bindless);
 }
 
-void cvdescriptorset::TexelDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::TexelDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                    const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
-    auto buffer_view = dev_data->GetConstCastShared<BUFFER_VIEW_STATE>(update->pTexelBufferView[index]);
+    auto buffer_view = state_cache.GetBufferView(update->pTexelBufferView[index]);
     ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
 }
 
@@ -841,7 +880,7 @@ void cvdescriptorset::TexelDescriptor::CopyUpdate(DescriptorSet *set_state, cons
     ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const TexelDescriptor *>(src)->buffer_view_state_, is_bindless);
 }
 
-void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                                    const VkWriteDescriptorSet *update, const uint32_t index,
                                                                    bool is_bindless) {
     const auto *acc_info = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureKHR>(update->pNext);
@@ -850,10 +889,10 @@ void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet
     is_khr_ = (acc_info != NULL);
     if (is_khr_) {
         acc_ = acc_info->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE_KHR>(acc_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_, state_cache.GetAccelerationStructure(acc_), is_bindless);
     } else {
         acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_nv_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE>(acc_nv_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_nv_, state_cache.GetAccelerationStructureNV(acc_nv_), is_bindless);
     }
 }
 
@@ -895,39 +934,35 @@ cvdescriptorset::MutableDescriptor::MutableDescriptor()
       is_khr_(false),
       acc_(VK_NULL_HANDLE) {}
 
-void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache,
                                                      const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     VkDeviceSize buffer_size = 0;
     switch (DescriptorTypeToClass(update->descriptorType)) {
         case DescriptorClass::PlainSampler:
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_,
-                                dev_data->GetConstCastShared<SAMPLER_STATE>(update->pImageInfo[index].sampler), is_bindless);
+                ReplaceStatePtr(set_state, sampler_state_, state_cache.GetSampler(update->pImageInfo[index].sampler), is_bindless);
             }
             break;
         case DescriptorClass::ImageSampler: {
             const auto &image_info = update->pImageInfo[index];
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(image_info.sampler),
-                                is_bindless);
+                ReplaceStatePtr(set_state, sampler_state_, state_cache.GetSampler(image_info.sampler), is_bindless);
             }
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, state_cache.GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::Image: {
             const auto &image_info = update->pImageInfo[index];
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, state_cache.GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::GeneralBuffer: {
             const auto &buffer_info = update->pBufferInfo[index];
             offset_ = buffer_info.offset;
             range_ = buffer_info.range;
-            const auto buffer_state = dev_data->GetConstCastShared<BUFFER_STATE>(update->pBufferInfo->buffer);
+            const auto buffer_state = state_cache.GetBuffer(update->pBufferInfo->buffer);
             if (buffer_state) {
                 buffer_size = buffer_state->createInfo.size;
             }
@@ -935,7 +970,7 @@ void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, c
             break;
         }
         case DescriptorClass::TexelBuffer: {
-            const auto buffer_view = dev_data->GetConstCastShared<BUFFER_VIEW_STATE>(update->pTexelBufferView[index]);
+            const auto buffer_view = state_cache.GetBufferView(update->pTexelBufferView[index]);
             if (buffer_view) {
                 buffer_size = buffer_view->buffer_state->createInfo.size;
             }
@@ -949,12 +984,10 @@ void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, c
             is_khr_ = (acc_info != NULL);
             if (is_khr_) {
                 acc_ = acc_info->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE_KHR>(acc_),
-                                is_bindless);
+                ReplaceStatePtr(set_state, acc_state_, state_cache.GetAccelerationStructure(acc_), is_bindless);
             } else {
                 acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_nv_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE>(acc_nv_),
-                                is_bindless);
+                ReplaceStatePtr(set_state, acc_state_nv_, state_cache.GetAccelerationStructureNV(acc_nv_), is_bindless);
             }
             break;
         }
@@ -1164,14 +1197,28 @@ void cvdescriptorset::PerformUpdateDescriptorSets(ValidationStateTracker *dev_da
                                                   const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                                   const VkCopyDescriptorSet *p_cds) {
     // Write updates first
+    // Writes to the same set usually come one after another, so the set is looked up once per run of writes and the command
+    // buffers it is bound to are invalidated once, after all of them
+    WriteStateCache state_cache(*dev_data);
+    std::shared_ptr<cvdescriptorset::DescriptorSet> set_node;
+    bool invalidate_set = false;
     uint32_t i = 0;
     for (i = 0; i < write_count; ++i) {
         auto dest_set = p_wds[i].dstSet;
-        auto set_node = dev_data->Get<cvdescriptorset::DescriptorSet>(dest_set);
+        if (!set_node || set_node->GetSet() != dest_set) {
+            if (invalidate_set) {
+                set_node->Invalidate(false);
+                invalidate_set = false;
+            }
+            set_node = dev_data->Get<cvdescriptorset::DescriptorSet>(dest_set);
+        }
         if (set_node) {
-            set_node->PerformWriteUpdate(dev_data, &p_wds[i]);
+            invalidate_set |= set_node->PerformWriteUpdate(state_cache, &p_wds[i]);
         }
     }
+    if (invalidate_set) {
+        set_node->Invalidate(false);
+    }
     // Now copy updates
     for (i = 0; i < copy_count; ++i) {
         auto dst_set = p_cds[i].dstSet;
@@ -337,12 +337,41 @@ DescriptorClass DescriptorTypeToClass(VkDescriptorType type);
 
 class DescriptorSet;
 
+// Resolves the resource handles of a batch of descriptor writes. Filling a binding array tends to repeat the same resource (a
+// default texture, one large buffer, ...), so the last state found for each type is kept and reused while its handle repeats.
+class WriteStateCache {
+  public:
+    explicit WriteStateCache(const ValidationStateTracker &dev_data) : dev_data_(dev_data) {}
+
+    std::shared_ptr<SAMPLER_STATE> GetSampler(VkSampler sampler);
+    std::shared_ptr<IMAGE_VIEW_STATE> GetImageView(VkImageView image_view);
+    std::shared_ptr<BUFFER_STATE> GetBuffer(VkBuffer buffer);
+    std::shared_ptr<BUFFER_VIEW_STATE> GetBufferView(VkBufferView buffer_view);
+    std::shared_ptr<ACCELERATION_STRUCTURE_STATE_KHR> GetAccelerationStructure(VkAccelerationStructureKHR acceleration_structure);
+    std::shared_ptr<ACCELERATION_STRUCTURE_STATE> GetAccelerationStructureNV(VkAccelerationStructureNV acceleration_structure);
+
+    template <typename State, typename Handle>
+    struct Entry {
+        Handle handle = VK_NULL_HANDLE;
+        std::shared_ptr<State> state;
+    };
+
+  private:
+    const ValidationStateTracker &dev_data_;
+    Entry<SAMPLER_STATE, VkSampler> sampler_;
+    Entry<IMAGE_VIEW_STATE, VkImageView> image_view_;
+    Entry<BUFFER_STATE, VkBuffer> buffer_;
+    Entry<BUFFER_VIEW_STATE, VkBufferView> buffer_view_;
+    Entry<ACCELERATION_STRUCTURE_STATE_KHR, VkAccelerationStructureKHR> acceleration_structure_;
+    Entry<ACCELERATION_STRUCTURE_STATE, VkAccelerationStructureNV> acceleration_structure_nv_;
+};
+
 class Descriptor {
   public:
     Descriptor() {}
     virtual ~Descriptor() {}
-    virtual void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *,
-                             const uint32_t, bool is_bindless) = 0;
+    virtual void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
+                             bool is_bindless) = 0;
     virtual void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                             bool is_bindless) = 0;
     virtual DescriptorClass GetClass() const = 0;
@@ -369,7 +398,7 @@ class SamplerDescriptor : public Descriptor {
   public:
     SamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return PlainSampler; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -409,7 +438,7 @@ class ImageDescriptor : public Descriptor {
   public:
     ImageDescriptor() = default;
     DescriptorClass GetClass() const override { return Image; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -444,7 +473,7 @@ class ImageSamplerDescriptor : public ImageDescriptor {
   public:
     ImageSamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return ImageSampler; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -486,7 +515,7 @@ class TexelDescriptor : public Descriptor {
   public:
     TexelDescriptor() = default;
     DescriptorClass GetClass() const override { return TexelBuffer; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -518,7 +547,7 @@ class BufferDescriptor : public Descriptor {
   public:
     BufferDescriptor() = default;
     DescriptorClass GetClass() const override { return GeneralBuffer; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -553,7 +582,7 @@ class InlineUniformDescriptor : public Descriptor {
   public:
     InlineUniformDescriptor() = default;
     DescriptorClass GetClass() const override { return InlineUniform; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override {}
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override {}
@@ -563,7 +592,7 @@ class AccelerationStructureDescriptor : public Descriptor {
   public:
     AccelerationStructureDescriptor() = default;
     DescriptorClass GetClass() const override { return AccelerationStructure; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_; }
     const ACCELERATION_STRUCTURE_STATE_KHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
@@ -613,7 +642,7 @@ class MutableDescriptor : public Descriptor {
   public:
     MutableDescriptor();
     DescriptorClass GetClass() const override { return Mutable; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, WriteStateCache &state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -799,11 +828,13 @@ using AccelerationStructureBinding = DescriptorBindingImpl<AccelerationStructure
 using MutableBinding = DescriptorBindingImpl<MutableDescriptor>;
 
 // Helper class to encapsulate the descriptor update template decoding logic
+// The writes point into pData, so they are only valid as long as it is. Typical templates decode without any heap allocation.
 struct DecodedTemplateUpdate {
-    std::vector<VkWriteDescriptorSet> desc_writes;
-    std::vector<VkWriteDescriptorSetInlineUniformBlockEXT> inline_infos;
-    std::vector<VkWriteDescriptorSetAccelerationStructureKHR> inline_infos_khr;
-    std::vector<VkWriteDescriptorSetAccelerationStructureNV> inline_infos_nv;
+    small_vector<VkWriteDescriptorSet, 32, uint32_t> desc_writes;
+    // Indexed by template entry, only sized when the template has an entry of that type
+    small_vector<VkWriteDescriptorSetInlineUniformBlockEXT, 1, uint32_t> inline_infos;
+    small_vector<VkWriteDescriptorSetAccelerationStructureKHR, 1, uint32_t> inline_infos_khr;
+    small_vector<VkWriteDescriptorSetAccelerationStructureNV, 1, uint32_t> inline_infos_nv;
     DecodedTemplateUpdate(const ValidationStateTracker *device_data, VkDescriptorSet descriptorSet,
                           const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
                           VkDescriptorSetLayout push_layout = VK_NULL_HANDLE);
@@ -860,6 +891,8 @@ class DescriptorSet : public BASE_NODE {
     void PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count, const VkWriteDescriptorSet *p_wds);
     // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
     void PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *);
+    // Same, but leaves invalidating the command buffers the set is bound to to the caller, returns true if that is needed
+    bool PerformWriteUpdate(WriteStateCache &state_cache, const VkWriteDescriptorSet *);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     void PerformCopyUpdate(ValidationStateTracker *dev_data, const VkCopyDescriptorSet *, const DescriptorSet *);
 
@@ -187,14 +187,33 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
         auto guard = WriteLockGuard{binding_lock_};
 
-        // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
-        for (auto &value_pair : binding_map_) {
-            if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+        // Only the bindings intersecting the new range can be trimmed or removed by the overwrite, so the parent links are
+        // updated from those alone rather than unlinking and relinking every binding of the resource on each bind.
+        sparse_container::range<VkDeviceSize> affected = item.first;
+        small_vector<std::shared_ptr<DEVICE_MEMORY_STATE>, 4, uint32_t> released;
+        const auto old_bounds = binding_map_.bounds(item.first);
+        for (auto it = old_bounds.begin; it != old_bounds.end; ++it) {
+            affected.begin = std::min(affected.begin, it->first.begin);
+            affected.end = std::max(affected.end, it->first.end);
+            if (it->second.memory_state) released.emplace_back(it->second.memory_state);
         }
         binding_map_.overwrite_range(item);
 
-        for (auto &value_pair : binding_map_) {
-            if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+        // Count the surviving (possibly trimmed) bindings and the new one before releasing the old ones, so a memory object
+        // that remains bound never drops to zero references in between
+        const auto new_bounds = binding_map_.bounds(affected);
+        for (auto it = new_bounds.begin; it != new_bounds.end; ++it) {
+            if (it->second.memory_state && (++bound_memory_counts_[it->second.memory_state.get()] == 1)) {
+                it->second.memory_state->AddParent(parent);
+            }
+        }
+        for (auto &memory_state : released) {
+            auto count_it = bound_memory_counts_.find(memory_state.get());
+            assert(count_it != bound_memory_counts_.end());
+            if (--count_it->second == 0) {
+                bound_memory_counts_.erase(count_it);
+                memory_state->RemoveParent(parent);
+            }
         }
     }
 
@@ -235,6 +254,8 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
     BindingMap binding_map_;
+    // Number of entries in binding_map_ referencing each memory object, the resource is a parent of those with a non-zero count
+    vvl::unordered_map<const DEVICE_MEMORY_STATE *, uint32_t> bound_memory_counts_;
     VkDeviceSize resource_size_;
     mutable std::shared_mutex binding_lock_;
 };
@@ -94,9 +94,25 @@ ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const IMAGE_STATE& image_st
       layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+// Generator for the single contiguous index range most barriers and attachment uses reduce to, avoiding the set up and
+// per mip/aspect stepping of RangeGenerator
+class SingleRangeGenerator {
+  public:
+    explicit SingleRangeGenerator(const IndexRange& range) : current_(range) {}
+    const IndexRange& operator*() const { return current_; }
+    const IndexRange* operator->() const { return &current_; }
+    SingleRangeGenerator& operator++() {
+        current_ = IndexRange();  // just one range
+        return *this;
+    }
+
+  private:
+    IndexRange current_;
+};
+
 // Use the unwrapped maps from the BothMap in the actual implementation
-template <typename LayoutMap>
-static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
+template <typename LayoutMap, typename RangeGen>
+static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGen& range_gen,
                                           const CMD_BUFFER_STATE& cb_state, VkImageLayout layout, VkImageLayout expected_layout) {
     bool updated = false;
     LayoutEntry entry(expected_layout, layout);
@@ -106,6 +122,20 @@ static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutState
     return updated;
 }
 
+template <typename RangeGen>
+static bool SetSubresourceRangeLayoutImpl(ImageSubresourceLayoutMap::LayoutMap& layouts, InitialLayoutStates& initial_layout_states,
+                                          RangeGen&& range_gen, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
+                                          VkImageLayout expected_layout) {
+    if (layouts.SmallMode()) {
+        return SetSubresourceRangeLayoutImpl(layouts.GetSmallMap(), initial_layout_states, range_gen, cb_state, layout,
+                                             expected_layout);
+    } else {
+        assert(!layouts.Tristate());
+        return SetSubresourceRangeLayoutImpl(layouts.GetBigMap(), initial_layout_states, range_gen, cb_state, layout,
+                                             expected_layout);
+    }
+}
+
 bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE& cb_state, const VkImageSubresourceRange& range,
                                                           VkImageLayout layout, VkImageLayout expected_layout) {
     if (expected_layout == kInvalidLayout) {
@@ -114,21 +144,19 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
-    RangeGenerator range_gen(encoder_, range);
-    if (layouts_.SmallMode()) {
-        return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
-                                             expected_layout);
-    } else {
-        assert(!layouts_.Tristate());
-        return SetSubresourceRangeLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
+    const IndexRange contiguous = encoder_.ContiguousRange(range);
+    if (contiguous.non_empty()) {
+        return SetSubresourceRangeLayoutImpl(layouts_, initial_layout_states_, SingleRangeGenerator(contiguous), cb_state, layout,
                                              expected_layout);
     }
+    return SetSubresourceRangeLayoutImpl(layouts_, initial_layout_states_, RangeGenerator(encoder_, range), cb_state, layout,
+                                         expected_layout);
 }
 
 // Use the unwrapped maps from the BothMap in the actual implementation
-template <typename LayoutMap>
+template <typename LayoutMap, typename RangeGen>
 static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states,
-                                                 RangeGenerator& range_gen, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
+                                                 RangeGen& range_gen, const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                  const IMAGE_VIEW_STATE* view_state) {
     LayoutEntry entry(layout);
     for (; range_gen->non_empty(); ++range_gen) {
@@ -137,31 +165,37 @@ static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayo
 }
 
 // Unwrap the BothMaps entry here as this is a performance hotspot.
+template <typename RangeGen>
+static void SetSubresourceRangeInitialLayoutImpl(ImageSubresourceLayoutMap::LayoutMap& layouts,
+                                                 InitialLayoutStates& initial_layout_states, RangeGen&& range_gen,
+                                                 const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
+                                                 const IMAGE_VIEW_STATE* view_state) {
+    if (layouts.SmallMode()) {
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetSmallMap(), initial_layout_states, range_gen, cb_state, layout, view_state);
+    } else {
+        assert(!layouts.Tristate());
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetBigMap(), initial_layout_states, range_gen, cb_state, layout, view_state);
+    }
+}
+
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state,
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
-    RangeGenerator range_gen(encoder_, range);
-    if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+    const IndexRange contiguous = encoder_.ContiguousRange(range);
+    if (contiguous.non_empty()) {
+        SetSubresourceRangeInitialLayoutImpl(layouts_, initial_layout_states_, SingleRangeGenerator(contiguous), cb_state, layout,
+                                             nullptr);
     } else {
-        assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+        SetSubresourceRangeInitialLayoutImpl(layouts_, initial_layout_states_, RangeGenerator(encoder_, range), cb_state, layout,
+                                             nullptr);
     }
 }
 
-// Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE& view_state) {
-    RangeGenerator range_gen(view_state.range_generator);
-    if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
-                                             &view_state);
-    } else {
-        assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
-                                             &view_state);
-    }
+    SetSubresourceRangeInitialLayoutImpl(layouts_, initial_layout_states_, RangeGenerator(view_state.range_generator), cb_state,
+                                         layout, &view_state);
 }
 
 // TODO: make sure this paranoia check is sufficient and not too much.
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -123,6 +124,9 @@ class ImageSubresourceLayoutMap {
     const LayoutMap& GetLayoutMap() const { return layouts_; }
     ImageSubresourceLayoutMap(const IMAGE_STATE& image_state);
     ~ImageSubresourceLayoutMap() {}
+
+    // Version of the image's global layout map these initial layouts last matched at submit time, 0 if never
+    mutable std::atomic<uint64_t> validated_global_version{0};
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
 
     // This looks a bit ponderous but kAspectCount is a compile time constant
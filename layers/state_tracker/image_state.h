@@ -64,8 +64,13 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Changes whenever any layout in the map does, only access it while holding the lock
+    uint64_t GetVersion() const { return version_; }
+    void UpdateVersion() { ++version_; }
+
   private:
     mutable std::shared_mutex lock_;
+    uint64_t version_{1};
 };
 
 // State for VkImage objects.
@@ -633,6 +633,9 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
             }
         }
     }
+
+    const auto *dynamic_state_ci = DynamicState();
+    dynamic_state = ~MakeStaticStateMask(dynamic_state_ci ? dynamic_state_ci->ptr() : nullptr);
 }
 
 PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const VkComputePipelineCreateInfo *pCreateInfo,
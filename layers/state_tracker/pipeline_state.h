@@ -18,6 +18,7 @@
  */
 #pragma once
 #include "utils/hash_vk_types.h"
+#include "generated/command_validation.h"
 #include "state_tracker/base_node.h"
 #include "state_tracker/sampler_state.h"
 #include "state_tracker/ray_tracing_state.h"
@@ -212,6 +213,9 @@ class PIPELINE_STATE : public BASE_NODE {
     const bool descriptor_buffer_mode = false;
     const bool uses_pipeline_robustness;
 
+    // The states listed in DynamicState(), including those accumulated from linked libraries. Only set for graphics pipelines.
+    CBDynamicFlags dynamic_state;
+
     CreateShaderModuleStates *csm_states = nullptr;
 
     // Executable or legacy pipeline
@@ -487,15 +491,7 @@ class PIPELINE_STATE : public BASE_NODE {
                                         CreateShaderModuleStates *csm_states);
 
     // Return true if for a given PSO, the given state enum is dynamic, else return false
-    bool IsDynamic(const VkDynamicState state) const {
-        const auto *dynamic_state = DynamicState();
-        if ((pipeline_type == VK_PIPELINE_BIND_POINT_GRAPHICS) && dynamic_state) {
-            for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; i++) {
-                if (state == dynamic_state->pDynamicStates[i]) return true;
-            }
-        }
-        return false;
-    }
+    bool IsDynamic(const CBDynamicStatus state) const { return dynamic_state[state]; }
 
   protected:
     static std::shared_ptr<VertexInputState> CreateVertexInputState(const PIPELINE_STATE &p, const ValidationStateTracker &state,
@@ -507,7 +507,7 @@ static inline bool IsImageOperandsBiasOffset(uint32_t type) {
                     spv::ImageOperandsConstOffsetsMask)) != 0;
 }
 
-SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_state) {
+void SHADER_MODULE_STATE::StaticData::Parse(const SHADER_MODULE_STATE& module_state) {
     // Parse the words first so we have instruction class objects to use
     {
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
@@ -749,14 +749,17 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
         type_struct_map[new_struct->id] = new_struct;
     }
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
+    // The EntryPoint itself needs the definitions table for FindDef, so it is built later by FindEntrypoint
     for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn));
+        entry_points.emplace_back(std::make_unique<EntryPointSlot>(*insn));
     }
-
-    SHADER_MODULE_STATE::SetPushConstantUsedInShader(module_state, entry_points);
 }
 
+SHADER_MODULE_STATE::StaticData::EntryPointSlot::EntryPointSlot(const Instruction& entrypoint_insn)
+    : entrypoint_insn(entrypoint_insn),
+      stage(static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(entrypoint_insn.Word(1)))),
+      name(entrypoint_insn.GetAsString(3)) {}
+
 void SHADER_MODULE_STATE::DescribeTypeInner(std::ostringstream& ss, uint32_t type, uint32_t indent) const {
     const Instruction* insn = FindDef(type);
     for (uint32_t i = 0; i < indent; i++) {
@@ -835,19 +838,21 @@ std::string SHADER_MODULE_STATE::DescribeType(uint32_t type) const {
 
 const SHADER_MODULE_STATE::StructInfo* SHADER_MODULE_STATE::FindEntrypointPushConstant(char const* name,
                                                                                        VkShaderStageFlagBits stageBits) const {
-    for (const auto& entry_point : static_data_.entry_points) {
-        if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
-            return &(entry_point->push_constant_used_in_shader);
-        }
-    }
-    return nullptr;
+    const auto entry_point = FindEntrypoint(name, stageBits);
+    return entry_point ? &(entry_point->push_constant_used_in_shader) : nullptr;
 }
 
 std::shared_ptr<const SHADER_MODULE_STATE::EntryPoint> SHADER_MODULE_STATE::FindEntrypoint(char const* name,
                                                                                            VkShaderStageFlagBits stageBits) const {
-    for (const auto& entry_point : static_data_.entry_points) {
-        if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
-            return entry_point;
+    for (const auto& slot : static_data_.entry_points) {
+        if (slot->stage == stageBits && strcmp(slot->name, name) == 0) {
+            // Modules can have many entry points that are never used, so only analyze the ones that are
+            std::call_once(slot->built, [this, &slot]() {
+                auto entry_point = std::make_shared<EntryPoint>(*this, slot->entrypoint_insn);
+                SetPushConstantUsedInShader(*this, *entry_point);
+                slot->entry_point = std::move(entry_point);
+            });
+            return slot->entry_point;
         }
     }
     return nullptr;
@@ -1225,17 +1230,13 @@ void SHADER_MODULE_STATE::SetUsedStructMember(const uint32_t variable_id, vvl::u
     }
 }
 
-void SHADER_MODULE_STATE::SetPushConstantUsedInShader(const SHADER_MODULE_STATE& module_state,
-                                                      std::vector<std::shared_ptr<SHADER_MODULE_STATE::EntryPoint>>& entry_points) {
-    for (auto& entrypoint : entry_points) {
-        for (const Instruction* var_insn : module_state.static_data_.variable_inst) {
-            if (var_insn->StorageClass() == spv::StorageClassPushConstant) {
-                const Instruction* type = module_state.FindDef(var_insn->Word(1));
-                entrypoint->push_constant_used_in_shader.root = &entrypoint->push_constant_used_in_shader;
-                module_state.DefineStructMember(type, entrypoint->push_constant_used_in_shader);
-                module_state.SetUsedStructMember(var_insn->Word(2), entrypoint->accessible_ids,
-                                                 entrypoint->push_constant_used_in_shader);
-            }
+void SHADER_MODULE_STATE::SetPushConstantUsedInShader(const SHADER_MODULE_STATE& module_state, EntryPoint& entrypoint) {
+    for (const Instruction* var_insn : module_state.static_data_.variable_inst) {
+        if (var_insn->StorageClass() == spv::StorageClassPushConstant) {
+            const Instruction* type = module_state.FindDef(var_insn->Word(1));
+            entrypoint.push_constant_used_in_shader.root = &entrypoint.push_constant_used_in_shader;
+            module_state.DefineStructMember(type, entrypoint.push_constant_used_in_shader);
+            module_state.SetUsedStructMember(var_insn->Word(2), entrypoint.accessible_ids, entrypoint.push_constant_used_in_shader);
         }
     }
 }
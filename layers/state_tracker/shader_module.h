@@ -20,6 +20,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -393,10 +394,12 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const SHADER_MODULE_STATE &module_state);
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
+        // Filled in place, as parsing looks up what has been parsed so far through the module
+        void Parse(const SHADER_MODULE_STATE &module_state);
+
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
@@ -437,8 +440,20 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         bool has_specialization_constants{false};
         bool has_invocation_repack_instruction{false};
 
-        // EntryPoint has pointer references inside it that need to be preserved
-        std::vector<std::shared_ptr<EntryPoint>> entry_points;
+        // Only the OpEntryPoint header is read with the module, the EntryPoint analysis is built the first time it is found
+        struct EntryPointSlot {
+            const Instruction &entrypoint_insn;
+            const VkShaderStageFlagBits stage;
+            const char *name;  // points into the OpEntryPoint instruction
+
+            std::once_flag built;
+            // EntryPoint has pointer references inside it that need to be preserved
+            std::shared_ptr<EntryPoint> entry_point;
+
+            EntryPointSlot(const Instruction &entrypoint_insn);
+        };
+        // Slots are never moved, once_flag can't be
+        std::vector<std::unique_ptr<EntryPointSlot>> entry_points;
 
         std::vector<std::shared_ptr<TypeStructInfo>> type_structs;  // All OpTypeStruct objects
         // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
@@ -464,27 +479,62 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         vvl::unordered_map<uint32_t, uint32_t> image_texel_pointer_members;               // <result id, image>
     };
 
+    // The SPIR-V words and everything parsed from them. None of it refers back to the module, so shader modules created from
+    // identical SPIR-V can share it, see ValidationStateTracker::CreateShaderModuleState
+    struct SpirvData {
+        explicit SpirvData(vvl::span<const uint32_t> code) : words(code.begin(), code.end()) {}
+
+        const std::vector<uint32_t> words;
+        StaticData static_data;
+    };
+
+  private:
+    const std::shared_ptr<SpirvData> spirv_data_;
+
+  public:
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
     const bool has_valid_spirv{false};
-    const StaticData static_data_;
+    const StaticData &static_data_;
 
     uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
 
     explicit SHADER_MODULE_STATE(vvl::span<const uint32_t> code)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words_(code.begin(), code.end()),
-          static_data_(*this) {}
+          spirv_data_(std::make_shared<SpirvData>(code)),
+          words_(spirv_data_->words),
+          static_data_(spirv_data_->static_data) {
+        spirv_data_->static_data.Parse(*this);
+    }
 
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
-          words_(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
+          spirv_data_(std::make_shared<SpirvData>(
+              vvl::span<const uint32_t>(create_info.pCode, create_info.codeSize / sizeof(uint32_t)))),
+          words_(spirv_data_->words),
           has_valid_spirv(true),
-          static_data_(*this),
+          static_data_(spirv_data_->static_data),
+          gpu_validation_shader_id(unique_shader_id) {
+        spirv_data_->static_data.Parse(*this);
+    }
+
+    // For a module with the same SPIR-V as one that was already parsed
+    SHADER_MODULE_STATE(std::shared_ptr<SpirvData> &&spirv_data, VkShaderModule shaderModule, uint32_t unique_shader_id)
+        : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
+          spirv_data_(std::move(spirv_data)),
+          words_(spirv_data_->words),
+          has_valid_spirv(true),
+          static_data_(spirv_data_->static_data),
           gpu_validation_shader_id(unique_shader_id) {}
 
-    SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
+    SHADER_MODULE_STATE()
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          spirv_data_(std::make_shared<SpirvData>(vvl::span<const uint32_t>())),
+          words_(spirv_data_->words),
+          static_data_(spirv_data_->static_data) {}
+
+    const std::shared_ptr<SpirvData> &GetSpirvData() const { return spirv_data_; }
 
     const Instruction *FindDef(uint32_t id) const {
         auto it = static_data_.definitions.find(id);
@@ -572,9 +622,8 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                            [find_capability](const spv::Capability &capability) { return capability == find_capability; });
     }
 
-    // Used to set push constants values at shader module initialization time
-    static void SetPushConstantUsedInShader(const SHADER_MODULE_STATE &module_state,
-                                            std::vector<std::shared_ptr<SHADER_MODULE_STATE::EntryPoint>> &entry_points);
+    // Used to set push constants values when the entry point is built
+    static void SetPushConstantUsedInShader(const SHADER_MODULE_STATE &module_state, EntryPoint &entrypoint);
 
   private:
     // The following are all helper functions to set the push constants values by tracking if the values are accessed in the entry
@@ -30,6 +30,7 @@
 #include "core_checks/shader_cc_validation.h"
 #include "sync/sync_utils.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "external/xxhash.h"
 
 // NOTE:  Beware the lifespan of the rp_begin when holding  the return.  If the rp_begin isn't a "safe" copy, "IMAGELESS"
 //        attachments won't persist past the API entry point exit.
@@ -2707,9 +2708,8 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
         const auto *raster_state = pipe_state->RasterizationState();
         const bool rasterization_enabled = raster_state && !raster_state->rasterizerDiscardEnable;
         const auto *viewport_state = pipe_state->ViewportState();
-        const auto *dynamic_state = pipe_state->DynamicState();
         cb_state->status &= ~cb_state->static_status;
-        cb_state->static_status = MakeStaticStateMask(dynamic_state ? dynamic_state->ptr() : nullptr);
+        cb_state->static_status = ~pipe_state->dynamic_state;
         cb_state->status |= cb_state->static_status;
         cb_state->dynamic_status = ~CBDynamicFlags(0);
         cb_state->dynamic_status &= ~cb_state->static_status;
@@ -3229,6 +3229,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
 
     cb_state->index_buffer_binding = IndexBufferBinding(Get<BUFFER_STATE>(buffer), offset, indexType);
+    cb_state->InvalidateValidatedDrawState();
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state]) {
@@ -4954,8 +4955,38 @@ std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleS
     if ((create_info.pCode[0] != spv::MagicNumber)) {
         return std::make_shared<SHADER_MODULE_STATE>();  // not valid SPIR-V
     }
+
+    const vvl::span<const uint32_t> code(create_info.pCode, create_info.codeSize / sizeof(uint32_t));
+    const uint64_t code_hash = XXH64(create_info.pCode, code.size() * sizeof(uint32_t), 0);
+    {
+        ReadLockGuard guard(shader_module_spirv_map_lock_);
+        if (const auto itr = shader_module_spirv_map_.find(code_hash); itr != shader_module_spirv_map_.cend()) {
+            auto spirv_data = itr->second.lock();
+            // The hash only finds the candidate, the words have to match too
+            if (spirv_data && spirv_data->words.size() == code.size() &&
+                std::equal(code.begin(), code.end(), spirv_data->words.begin())) {
+                return std::make_shared<SHADER_MODULE_STATE>(std::move(spirv_data), handle, unique_shader_id);
+            }
+        }
+    }
+
     const auto module_state = std::make_shared<SHADER_MODULE_STATE>(create_info, handle, unique_shader_id);
-    if (module_state->static_data_.has_group_decoration) {
+    if (!module_state->static_data_.has_group_decoration) {
+        WriteLockGuard guard(shader_module_spirv_map_lock_);
+        // Drop the entries of destroyed modules every time the map doubles, so it stays bounded by the live modules
+        if (shader_module_spirv_map_.size() >= shader_module_spirv_map_prune_size_) {
+            for (auto itr = shader_module_spirv_map_.begin(); itr != shader_module_spirv_map_.end();) {
+                if (itr->second.expired()) {
+                    itr = shader_module_spirv_map_.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+            shader_module_spirv_map_prune_size_ = std::max<size_t>(64, shader_module_spirv_map_.size() * 2);
+        }
+        // On a hash collision the newest module wins, the other one just won't be shared anymore
+        shader_module_spirv_map_[code_hash] = module_state->GetSpirvData();
+    } else {
         spvtools::Optimizer optimizer(spirv_environment);
         optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
         std::vector<uint32_t> optimized_binary;
@@ -5416,16 +5447,8 @@ void ValidationStateTracker::PostCallRecordCmdSetVertexInputEXT(
 
     const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
     const auto pipeline_state = cb_state->lastBound[lv_bind_point].pipeline_state;
-    if (pipeline_state) {
-        const auto *dynamic_state = pipeline_state->DynamicState();
-        if (dynamic_state) {
-            for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; ++i) {
-                if (dynamic_state->pDynamicStates[i] == VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT) {
-                    status_flags.set(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET);
-                    break;
-                }
-            }
-        }
+    if (pipeline_state && pipeline_state->IsDynamic(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET)) {
+        status_flags.set(CB_DYNAMIC_VERTEX_INPUT_BINDING_STRIDE_SET);
     }
     cb_state->RecordStateCmd(CMD_SETVERTEXINPUTEXT, status_flags);
 }
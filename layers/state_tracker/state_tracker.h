@@ -1607,6 +1607,12 @@ class ValidationStateTracker : public ValidationObject {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<SHADER_MODULE_STATE>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
+    // Applications often create the same SPIR-V many times (once per pipeline, per thread, ...), keep track of the parsed data of
+    // live shader modules by hash of their code so it is only parsed once
+    mutable vvl::unordered_map<uint64_t, std::weak_ptr<SHADER_MODULE_STATE::SpirvData>> shader_module_spirv_map_;
+    mutable size_t shader_module_spirv_map_prune_size_ = 64;
+    mutable std::shared_mutex shader_module_spirv_map_lock_;
+
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
     vvl::unordered_map<int, VkMemoryAllocateInfo> fd_handle_map_;
     mutable std::shared_mutex fd_handle_map_lock_;
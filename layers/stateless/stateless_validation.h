@@ -511,9 +511,6 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != nullptr) {
-            vvl::unordered_set<const void *> cycle_check;
-            vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
-
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
@@ -529,20 +526,27 @@ class StatelessValidation : public ValidationObject {
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
+                // The loader structures are only expected in the chains of the instance and device create infos
+                const bool is_create_instance = strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0;
+                const bool is_create_device = strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0;
+
+                // Chains are short, so a linear search of the types seen so far, kept on the stack, is cheaper than hashing.
+                // Strings are only built for the messages of the error paths.
+                small_vector<VkStructureType, 16, uint32_t> unique_stype_check;
+
                 while (current != nullptr) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end() &&
-                            !IsDuplicatePnext(current->sType)) {
-                            // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
-                            std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
-                            skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
+                    if ((!is_create_instance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
+                        (!is_create_device || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
+                        if (std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                            unique_stype_check.end()) {
+                            if (!IsDuplicatePnext(current->sType)) {
+                                // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
+                                std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
+                                skip_call |= LogError(device, stype_vuid, message.c_str(), api_name,
+                                                      parameter_name.get_name().c_str(), string_VkStructureType(current->sType));
+                            }
                         } else {
-                            unique_stype_check.insert(current->sType);
+                            unique_stype_check.emplace_back(current->sType);
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
@@ -555,7 +559,8 @@ class StatelessValidation : public ValidationObject {
                         }
                         if (!custom) {
                             if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                                const char *type_name = string_VkStructureType(current->sType);
+                                if (UnsupportedStructureTypeString.compare(type_name) == 0) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
@@ -569,8 +574,8 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid, is_physdev_api,
@@ -655,7 +660,6 @@ class StatelessValidation : public ValidationObject {
      * @param apiName Name of API call being validated.
      * @param parameterName Name of parameter being validated.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
      * @param value Enumeration value to validate.
      * @return Boolean value indicating that the call should be skipped.
      */
@@ -663,9 +667,8 @@ class StatelessValidation : public ValidationObject {
     bool ValidateRangedEnum(const char *apiName, const ParameterName &parameterName, const char *enumName, T value,
                             const char *vuid) const {
         bool skip = false;
-        const auto valid_values = ValidParamValues<T>();
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
+        if (!IsValidEnumValue(value)) {
             skip |=
                 LogError(device, vuid,
                          "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
@@ -690,7 +693,6 @@ class StatelessValidation : public ValidationObject {
      * @param countName Name of count parameter.
      * @param arrayName Name of array parameter.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
      * @param count Number of enumeration values in the array.
      * @param array Array of enumeration values to validate.
      * @param countRequired The 'count' parameter may not be 0 when true.
@@ -702,14 +704,13 @@ class StatelessValidation : public ValidationObject {
                                  const char *enumName, uint32_t count, const T *array, bool countRequired,
                                  bool arrayRequired) const {
         bool skip_call = false;
-        const auto valid_values = ValidParamValues<T>();
 
         if ((count == 0) || (array == nullptr)) {
             skip_call |= ValidateArray(apiName, countName, arrayName, count, &array, countRequired, arrayRequired, kVUIDUndefined,
                                        kVUIDUndefined);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!IsValidEnumValue(array[i])) {
                     skip_call |= LogError(device, kVUID_PVError_UnrecognizedValue,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
@@ -726,13 +727,12 @@ class StatelessValidation : public ValidationObject {
                                  const ParameterName &arrayName, const char *enumName, uint32_t count, const T *array,
                                  bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
-        const auto valid_values = ValidParamValues<T>();
 
         if ((count == 0) || (array == nullptr)) {
             skip_call |= ValidateArray(apiName, countName, arrayName, count, &array, countRequired, arrayRequired, vuid, vuid);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!IsValidEnumValue(array[i])) {
                     skip_call |= LogError(device, vuid,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
@@ -114,16 +114,9 @@ VkAccessFlags2KHR ExpandAccessFlags(VkAccessFlags2KHR access_mask) {
 
 VkAccessFlags2KHR CompatibleAccessMask(VkPipelineStageFlags2KHR stage_mask) {
     VkAccessFlags2KHR result = 0;
-    stage_mask = ExpandPipelineStages(stage_mask);
-    for (size_t i = 0; i < kNumPipelineStageBits; i++) {
-        VkPipelineStageFlags2KHR bit = 1ULL << i;
-        if (stage_mask & bit) {
-            auto access_rec = syncDirectStageToAccessMask().find(bit);
-            if (access_rec != syncDirectStageToAccessMask().end()) {
-                result |= access_rec->second;
-                continue;
-            }
-        }
+    const auto &direct_access = syncDirectStageToAccessMaskByBitIndex();
+    for (auto unscanned = ExpandPipelineStages(stage_mask); unscanned; unscanned &= unscanned - 1) {
+        result |= direct_access[LeastSignificantBit64(unscanned)];
     }
 
     // put the meta-access bits back on
@@ -139,26 +132,20 @@ VkAccessFlags2KHR CompatibleAccessMask(VkPipelineStageFlags2KHR stage_mask) {
 }
 
 VkPipelineStageFlags2KHR RelatedPipelineStages(VkPipelineStageFlags2KHR stage_mask,
-                                               const std::map<VkPipelineStageFlags2KHR, VkPipelineStageFlags2KHR> &map) {
-    VkPipelineStageFlags2KHR unscanned = stage_mask;
+                                               const std::array<VkPipelineStageFlags2KHR, 64> &related_by_bit_index) {
     VkPipelineStageFlags2KHR related = 0;
-    for (const auto &entry : map) {
-        const auto &stage = entry.first;
-        if (stage & unscanned) {
-            related = related | entry.second;
-            unscanned = unscanned & ~stage;
-            if (!unscanned) break;
-        }
+    for (auto unscanned = stage_mask; unscanned; unscanned &= unscanned - 1) {
+        related |= related_by_bit_index[LeastSignificantBit64(unscanned)];
     }
     return related;
 }
 
 VkPipelineStageFlags2KHR WithEarlierPipelineStages(VkPipelineStageFlags2KHR stage_mask) {
-    return stage_mask | RelatedPipelineStages(stage_mask, syncLogicallyEarlierStages());
+    return stage_mask | RelatedPipelineStages(stage_mask, syncLogicallyEarlierStagesByBitIndex());
 }
 
 VkPipelineStageFlags2KHR WithLaterPipelineStages(VkPipelineStageFlags2KHR stage_mask) {
-    return stage_mask | RelatedPipelineStages(stage_mask, syncLogicallyLaterStages());
+    return stage_mask | RelatedPipelineStages(stage_mask, syncLogicallyLaterStagesByBitIndex());
 }
 
 int GetGraphicsPipelineStageLogicalOrdinal(VkPipelineStageFlags2KHR flag) {
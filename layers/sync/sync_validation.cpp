@@ -241,7 +241,7 @@ std::ostream &operator<<(std::ostream &out, const SyncNodeFormatter &formatter)
 std::ostream &operator<<(std::ostream &out, const NamedHandle::FormatterState &formatter) {
     const NamedHandle &handle = formatter.that;
     bool labeled = false;
-    if (!handle.name.empty()) {
+    if (handle.name) {
         out << handle.name;
         labeled = true;
     }
@@ -309,10 +309,11 @@ static void InitSubpassContexts(VkQueueFlags queue_flags, const RENDER_PASS_STAT
                                 std::vector<AccessContext> &subpass_contexts) {
     const auto &create_info = rp_state.createInfo;
     // Add this for all subpasses here so that they exsist during next subpass validation
-    subpass_contexts.clear();
-    subpass_contexts.reserve(create_info.subpassCount);
+    // Contexts already present are reinitialized in place, reusing their allocations. Sizing happens before any Init, as the
+    // contexts point to each other.
+    subpass_contexts.resize(create_info.subpassCount);
     for (uint32_t pass = 0; pass < create_info.subpassCount; pass++) {
-        subpass_contexts.emplace_back(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
+        subpass_contexts[pass].Init(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
     }
 }
 
@@ -808,6 +809,11 @@ void HazardResult::AddRecordedAccess(const ResourceFirstAccess &first_access) {
 AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
+    Init(subpass, queue_flags, dependencies, contexts, external_context);
+}
+
+void AccessContext::Init(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
+                         const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
     Reset();
     const auto &subpass_dep = dependencies[subpass];
     const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
@@ -838,12 +844,15 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 }
 
 void AccessContext::Trim() {
-    auto normalize = [](AccessAddressType address_type, ResourceAccessRangeMap::value_type &access) { access.second.Normalize(); };
-    ForAll(normalize);
-
-    // Consolidate map after normalization, combines directly adjacent ranges with common values.
     for (auto &map : access_state_maps_) {
-        sparse_container::consolidate(map);
+        // A shared map is an unmodified snapshot of another context, don't copy it just to trim it
+        if (map.use_count() > 1) continue;
+
+        for (auto &access : *map) {
+            access.second.Normalize();
+        }
+        // Consolidate map after normalization, combines directly adjacent ranges with common values.
+        sparse_container::consolidate(*map);
     }
 }
 
@@ -854,9 +863,28 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     ConstForAll(gather);
 }
 
+// True if this context, or any context previous to it, has access state for any part of range
+bool AccessContext::HasAccess(AccessAddressType type, const ResourceAccessRange &range) const {
+    const auto &accesses = GetAccessStateMap(type);
+    const auto pos = accesses.lower_bound(range);
+    if ((pos != accesses.cend()) && (pos->first.begin < range.end)) return true;
+    return HasPreviousAccess(type, range);
+}
+
+// Walks the same DAG as ResolvePreviousAccess, without copying or applying barriers to any access state
+bool AccessContext::HasPreviousAccess(AccessAddressType type, const ResourceAccessRange &range) const {
+    for (const auto &prev_dep : prev_) {
+        if (prev_dep.source_subpass->HasAccess(type, range)) return true;
+    }
+    return false;
+}
+
 template <typename Detector>
 HazardResult AccessContext::DetectPreviousHazard(AccessAddressType type, Detector &detector,
                                                  const ResourceAccessRange &range) const {
+    // Ranges first used in this context have nothing to resolve, don't build the descent map for them
+    if (!HasPreviousAccess(type, range)) return HazardResult();
+
     ResourceAccessRangeMap descent_map;
     ResolvePreviousAccess(type, range, &descent_map, nullptr);
 
@@ -1638,7 +1666,12 @@ SyncStageAccessFlags AccessScopeImpl(Flags flag_mask, const Map &map) {
 }
 
 SyncStageAccessFlags SyncStageAccess::AccessScopeByStage(VkPipelineStageFlags2KHR stages) {
-    return AccessScopeImpl(stages, syncStageAccessMaskByStageBit());
+    const auto &stage_access_by_bit_index = syncStageAccessMaskByStageBitIndex();
+    SyncStageAccessFlags scope = 0;
+    for (auto unscanned = stages; unscanned; unscanned &= unscanned - 1) {
+        scope |= stage_access_by_bit_index[LeastSignificantBit64(unscanned)];
+    }
+    return scope;
 }
 
 SyncStageAccessFlags SyncStageAccess::AccessScopeByAccess(VkAccessFlags2KHR accesses) {
@@ -1974,6 +2007,10 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
 // Caller must ensure that lifespan of this is less than from
 void AccessContext::ImportAsyncContexts(const AccessContext &from) { async_ = from.async_; }
 
+// Equivalent to a NoopBarrierAction resolve of from into an empty context, without copying any of the access state until
+// it is modified.
+void AccessContext::ShareAccessStateMaps(const AccessContext &from) { access_state_maps_ = from.access_state_maps_; }
+
 // Suitable only for *subpass* access contexts
 HazardResult AccessContext::DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const {
     if (!attach_view.IsValid()) return HazardResult();
@@ -2373,8 +2410,15 @@ ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(CMD_TYPE cmd_
     const auto barrier_tag = NextCommandTag(cmd_type, NamedHandle("renderpass", rp_state.Handle()),
                                             ResourceUsageRecord::SubcommandType::kSubpassTransition);
     const auto load_tag = NextSubcommandTag(cmd_type, ResourceUsageRecord::SubcommandType::kLoadOp);
-    render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+    if (render_pass_context_pool_.empty()) {
+        render_pass_contexts_.emplace_back(std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(),
+                                                                                     attachment_views, &cb_access_context_));
+    } else {
+        // Reuse a render pass context from a previous recording of this command buffer, with its subpass contexts
+        render_pass_contexts_.emplace_back(std::move(render_pass_context_pool_.back()));
+        render_pass_context_pool_.pop_back();
+        render_pass_contexts_.back()->Init(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_);
+    }
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -2418,12 +2462,11 @@ bool CommandBufferAccessContext::ValidateFirstUse(CommandExecutionContext &exec_
                                                   uint32_t index) const {
     if (!exec_context.ValidForSyncOps()) return false;
 
+    BuildFirstUseSegments();
     const QueueId queue_id = exec_context.GetQueueId();
     const ResourceUsageTag base_tag = exec_context.GetTagLimit();
     bool skip = false;
     ResourceUsageRange tag_range = {0, 0};
-    const AccessContext *recorded_context = GetCurrentAccessContext();
-    assert(recorded_context);
     HazardResult hazard;
     ReplayGuard replay_guard(exec_context, *this);
 
@@ -2457,7 +2500,7 @@ bool CommandBufferAccessContext::ValidateFirstUse(CommandExecutionContext &exec_
 
     // and anything after the last syncop
     tag_range.end = ResourceUsageRecord::kMaxIndex;
-    hazard = recorded_context->DetectFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext());
+    hazard = DetectRecordedFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext());
     if (hazard.hazard) {
         skip |= log_msg(hazard, exec_context, func_name, index);
     }
@@ -2487,8 +2530,70 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
     GetCurrentAccessContext()->ResolveFromContext(tag_offset, recorded_context);
 }
 
+// Sort the recorded first uses into the tag ranges ValidateFirstUse will check, so that the many executions or submissions
+// of a command buffer each visit only the access states with first uses in a given range, rather than all of them
+void CommandBufferAccessContext::BuildFirstUseSegments() const {
+    {
+        ReadLockGuard lock(first_use_segments_lock_);
+        if (first_use_segments_built_) return;
+    }
+    WriteLockGuard lock(first_use_segments_lock_);
+    if (first_use_segments_built_) return;
+
+    // Still recording, leave it to the full search. This includes an unended render pass instance, which hasn't been resolved
+    // into the command buffer context.
+    if ((cb_state_->state != CB_RECORDED) || (current_context_ != &cb_access_context_)) return;
+    first_use_segments_built_ = true;
+    // With no sync ops there is only the one range, for which the full search is just as cheap
+    if (sync_ops_.empty()) return;
+
+    first_use_segments_.reserve(sync_ops_.size() + 1);
+    ResourceUsageRange tag_range = {0, 0};
+    for (const auto &sync_op : sync_ops_) {
+        tag_range.end = sync_op.tag + 1;
+        first_use_segments_.emplace_back(FirstUseSegment{tag_range, AccessContext::FirstUses()});
+        tag_range.begin = tag_range.end;
+    }
+    tag_range.end = ResourceUsageRecord::kMaxIndex;
+    first_use_segments_.emplace_back(FirstUseSegment{tag_range, AccessContext::FirstUses()});
+
+    const auto segment_end = first_use_segments_.end();
+    for (const auto address_type : kAddressTypes) {
+        for (const auto &recorded_access : cb_access_context_.GetAccessStateMap(address_type)) {
+            const ResourceUsageRange first_access_range = recorded_access.second.FirstAccessRange();
+            if (first_access_range.empty()) continue;
+
+            // The segments are in tag order, so start with the first that ends after the first access range begins
+            auto segment = std::upper_bound(first_use_segments_.begin(), segment_end, first_access_range.begin,
+                                            [](ResourceUsageTag tag, const FirstUseSegment &segment) {
+                                                return tag < segment.tag_range.end;
+                                            });
+            for (; (segment != segment_end) && (segment->tag_range.begin < first_access_range.end); ++segment) {
+                if (!segment->tag_range.intersects(first_access_range)) continue;
+                segment->first_uses.emplace_back(
+                    AccessContext::FirstUse{address_type, recorded_access.first, &recorded_access.second});
+            }
+        }
+    }
+}
+
 HazardResult CommandBufferAccessContext::DetectFirstUseHazard(const ResourceUsageRange &tag_range) {
-    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, *GetCurrentAccessContext());
+    return current_replay_->DetectRecordedFirstUseHazard(GetQueueId(), tag_range, *GetCurrentAccessContext());
+}
+
+HazardResult CommandBufferAccessContext::DetectRecordedFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                                      const AccessContext &access_context) const {
+    auto segment = std::lower_bound(
+        first_use_segments_.cbegin(), first_use_segments_.cend(), tag_range.begin,
+        [](const FirstUseSegment &segment, ResourceUsageTag tag) { return segment.tag_range.begin < tag; });
+    for (; (segment != first_use_segments_.cend()) && (segment->tag_range.begin == tag_range.begin); ++segment) {
+        if (segment->tag_range == tag_range) {
+            return access_context.DetectFirstUseHazard(queue_id, tag_range, segment->first_uses);
+        }
+    }
+
+    // Still recording, or checking a range BuildFirstUseSegments didn't anticipate
+    return GetCurrentAccessContext()->DetectFirstUseHazard(queue_id, tag_range, access_context);
 }
 
 ResourceUsageRange CommandExecutionContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
@@ -2582,13 +2687,25 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
             if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
             HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
             hazard = access_context.DetectHazard(address_type, detector, recorded_access.first, DetectOptions::kDetectAll);
-            if (hazard.hazard) break;
+            if (hazard.hazard) return hazard;
         }
     }
 
     return hazard;
 }
 
+HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                 const FirstUses &first_uses) const {
+    HazardResult hazard;
+    for (const auto &first_use : first_uses) {
+        HazardDetectFirstUse detector(*first_use.access, queue_id, tag_range);
+        hazard = DetectHazard(first_use.address_type, detector, first_use.range, DetectOptions::kDetectAll);
+        if (hazard.hazard) break;
+    }
+
+    return hazard;
+}
+
 bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecutionContext &exec_context,
                                                             const CMD_BUFFER_STATE &cmd_buffer, CMD_TYPE cmd_type) const {
     bool skip = false;
@@ -2641,13 +2758,13 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
         const IMAGE_VIEW_STATE &view_state = *view_gen.GetViewState();
         bool depth_write = false, stencil_write = false;
 
-        const bool depth_write_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE)
+        const bool depth_write_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET)
                                             ? cmd_buffer.dynamic_state_value.depth_write_enable
                                             : ds_state->depthWriteEnable;
-        const bool depth_test_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE)
+        const bool depth_test_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_TEST_ENABLE_SET)
                                            ? cmd_buffer.dynamic_state_value.depth_test_enable
                                            : ds_state->depthTestEnable;
-        const bool stencil_test_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE)
+        const bool stencil_test_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET)
                                              ? cmd_buffer.dynamic_state_value.stencil_test_enable
                                              : ds_state->stencilTestEnable;
 
@@ -2737,13 +2854,13 @@ void RenderPassAccessContext::RecordDrawSubpassAttachment(const CMD_BUFFER_STATE
         const bool has_depth = 0 != (view_state.normalized_subresource_range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT);
         const bool has_stencil = 0 != (view_state.normalized_subresource_range.aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT);
 
-        const bool depth_write_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE)
+        const bool depth_write_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET)
                                             ? cmd_buffer.dynamic_state_value.depth_write_enable
                                             : ds_state->depthWriteEnable;
-        const bool depth_test_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE)
+        const bool depth_test_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_TEST_ENABLE_SET)
                                            ? cmd_buffer.dynamic_state_value.depth_test_enable
                                            : ds_state->depthTestEnable;
-        const bool stencil_test_enable = pipe->IsDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE)
+        const bool stencil_test_enable = pipe->IsDynamic(CB_DYNAMIC_DEPTH_WRITE_ENABLE_SET)
                                              ? cmd_buffer.dynamic_state_value.stencil_test_enable
                                              : ds_state->stencilTestEnable;
 
@@ -3080,22 +3197,45 @@ void RenderPassAccessContext::RecordLoadOperations(const ResourceUsageTag tag) {
 AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     const VkRect2D &render_area, const std::vector<const IMAGE_VIEW_STATE *> &attachment_views) {
     AttachmentViewGenVector view_gens;
+    InitAttachmentViewGen(render_area, attachment_views, view_gens);
+    return view_gens;
+}
+void RenderPassAccessContext::InitAttachmentViewGen(const VkRect2D &render_area,
+                                                    const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
+                                                    AttachmentViewGenVector &view_gens) {
     VkExtent3D extent = CastTo3D(render_area.extent);
     VkOffset3D offset = CastTo3D(render_area.offset);
+    view_gens.clear();
     view_gens.reserve(attachment_views.size());
     for (const auto *view : attachment_views) {
         view_gens.emplace_back(view, offset, extent);
     }
-    return view_gens;
 }
 RenderPassAccessContext::RenderPassAccessContext(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area,
                                                  VkQueueFlags queue_flags,
                                                  const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
                                                  const AccessContext *external_context)
-    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0U), attachment_views_() {
+    Init(rp_state, render_area, queue_flags, attachment_views, external_context);
+}
+void RenderPassAccessContext::Init(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+                                   const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
+                                   const AccessContext *external_context) {
+    rp_state_ = &rp_state;
+    render_area_ = render_area;
+    current_subpass_ = 0U;
     // Add this for all subpasses here so that they exist during next subpass validation
     InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
-    attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
+    InitAttachmentViewGen(render_area, attachment_views, attachment_views_);
+}
+void RenderPassAccessContext::Reset() {
+    rp_state_ = nullptr;
+    render_area_ = VkRect2D();
+    current_subpass_ = 0U;
+    for (auto &context : subpass_contexts_) {
+        context.Reset();
+    }
+    attachment_views_.clear();
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
     assert(0 == current_subpass_);
@@ -3884,8 +4024,13 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
 
 bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
     if (!first_accesses_.size()) return false;
-    const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
-    return tag_range.intersects(first_access_range);
+    return tag_range.intersects(FirstAccessRange());
+}
+
+// The tag range spanned by the first accesses, or an empty range if there are none
+ResourceUsageRange ResourceAccessState::FirstAccessRange() const {
+    if (!first_accesses_.size()) return ResourceUsageRange();
+    return ResourceUsageRange(first_accesses_.front().tag, first_accesses_.back().tag + 1);
 }
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
@@ -6891,9 +7036,13 @@ void SyncOpBarriers::BarrierSet::MakeImageMemoryBarriers(const SyncValidator &sy
                                                          const SyncExecScope &dst, VkDependencyFlags dependencyFlags,
                                                          uint32_t barrier_count, const VkImageMemoryBarrier *barriers) {
     image_memory_barriers.reserve(barrier_count);
+    SyncImageMemoryBarrier::Image image;
     for (uint32_t index = 0; index < barrier_count; index++) {
         const auto &barrier = barriers[index];
-        auto image = sync_state.Get<IMAGE_STATE>(barrier.image);
+        // Reuse the state lookup for consecutive barriers of the same image
+        if (!image || (image->image() != barrier.image)) {
+            image = sync_state.Get<IMAGE_STATE>(barrier.image);
+        }
         if (image) {
             auto subresource_range = NormalizeSubresourceRange(image->createInfo, barrier.subresourceRange);
             const SyncBarrier sync_barrier(barrier, src, dst);
@@ -6909,11 +7058,22 @@ void SyncOpBarriers::BarrierSet::MakeImageMemoryBarriers(const SyncValidator &sy
                                                          VkDependencyFlags dependencyFlags, uint32_t barrier_count,
                                                          const VkImageMemoryBarrier2 *barriers) {
     image_memory_barriers.reserve(barrier_count);
+    SyncImageMemoryBarrier::Image image;
+    SyncExecScope src;
+    SyncExecScope dst;
     for (uint32_t index = 0; index < barrier_count; index++) {
         const auto &barrier = barriers[index];
-        auto src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
-        auto dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
-        auto image = sync_state.Get<IMAGE_STATE>(barrier.image);
+        // Large barrier batches usually share stage masks, only expand them when they change
+        if ((index == 0) || (barrier.srcStageMask != barriers[index - 1].srcStageMask)) {
+            src = SyncExecScope::MakeSrc(queue_flags, barrier.srcStageMask);
+        }
+        if ((index == 0) || (barrier.dstStageMask != barriers[index - 1].dstStageMask)) {
+            dst = SyncExecScope::MakeDst(queue_flags, barrier.dstStageMask);
+        }
+        // Reuse the state lookup for consecutive barriers of the same image
+        if (!image || (image->image() != barrier.image)) {
+            image = sync_state.Get<IMAGE_STATE>(barrier.image);
+        }
         if (image) {
             auto subresource_range = NormalizeSubresourceRange(image->createInfo, barrier.subresourceRange);
             const SyncBarrier sync_barrier(barrier, src, dst);
@@ -8208,7 +8368,7 @@ HazardResult QueueBatchContext::DetectFirstUseHazard(const ResourceUsageRange &t
     if (rp_replay_) {
         return rp_replay_.replay_context->DetectFirstUseHazard(GetQueueId(), tag_range, *current_access_context_);
     }
-    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, access_context_);
+    return current_replay_->DetectRecordedFirstUseHazard(GetQueueId(), tag_range, access_context_);
 }
 
 void QueueBatchContext::BeginRenderPassReplay(const SyncOpBeginRenderPass &begin_op, const ResourceUsageTag tag) {
@@ -8493,7 +8653,7 @@ void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatc
 
 void QueueBatchContext::SetupAccessContext(const PresentedImage &presented) {
     if (presented.batch) {
-        access_context_.ResolveFromContext(NoopBarrierAction(), presented.batch->access_context_);
+        access_context_.ShareAccessStateMaps(presented.batch->access_context_);
         batch_log_.Import(presented.batch->batch_log_);
         ImportSyncTags(*presented.batch);
     }
@@ -8507,7 +8667,13 @@ void QueueBatchContext::CommonSetupAccessContext(const std::shared_ptr<const Que
         events_context_.DeepCopy(prev->events_context_);
         if (!vvl::Contains(batches_resolved, prev)) {
             // If there are no semaphores to the previous batch, make sure a "submit order" non-barriered import is done
-            access_context_.ResolveFromContext(NoopBarrierAction(), prev->access_context_);
+            if (batches_resolved.empty()) {
+                // Nothing has been imported yet, so the previous batch's access state can be shared rather than copied.
+                // Only the address types this batch accesses will be copied, when first updated.
+                access_context_.ShareAccessStateMaps(prev->access_context_);
+            } else {
+                access_context_.ResolveFromContext(NoopBarrierAction(), prev->access_context_);
+            }
             batches_resolved.emplace(prev);
         }
     }
@@ -8742,6 +8908,42 @@ void BatchAccessLog::Insert(const BatchRecord &batch, const ResourceUsageRange &
     log_map_.insert(std::make_pair(range, CBSubmitLog(batch, nullptr, std::move(log))));
 }
 
+void ResourceUsageTagSet::insert(ResourceUsageTag tag) {
+    // Tags are mostly gathered in increasing order, so check the last range before searching
+    if (ranges_.empty() || (tag > ranges_.back().end)) {
+        ranges_.emplace_back(tag, tag + 1);
+        return;
+    }
+    if (tag == ranges_.back().end) {
+        ranges_.back().end = tag + 1;
+        return;
+    }
+
+    // The first range ending at or after tag, which is either the range including tag, or the one tag could extend
+    auto range = std::lower_bound(ranges_.begin(), ranges_.end(), tag,
+                                  [](const ResourceUsageRange &range, ResourceUsageTag tag) { return range.end < tag; });
+    assert(range != ranges_.end());
+    if (range->end == tag) {
+        // Extend the end, joining the next range if that closes the gap
+        range->end = tag + 1;
+        auto next = range + 1;
+        if ((next != ranges_.end()) && (next->begin == range->end)) {
+            range->end = next->end;
+            ranges_.erase(next);
+        }
+    } else if (range->begin == tag + 1) {
+        // The previous range ends before tag, so there is nothing to join
+        range->begin = tag;
+    } else if (range->begin > tag) {
+        ranges_.emplace(range, tag, tag + 1);
+    }
+}
+
+ResourceUsageTagSet::const_iterator ResourceUsageTagSet::lower_bound(ResourceUsageTag tag) const {
+    return std::lower_bound(ranges_.cbegin(), ranges_.cend(), tag,
+                            [](const ResourceUsageRange &range, ResourceUsageTag tag) { return range.end <= tag; });
+}
+
 // Trim: Remove any unreferenced AccessLog ranges from a BatchAccessLog
 //
 // In order to contain memory growth in the AccessLog information regarding prior submitted command buffers,
@@ -8752,45 +8954,42 @@ void BatchAccessLog::Insert(const BatchRecord &batch, const ResourceUsageRange &
 // containing parent QueueBatchContext.
 //
 // The algorithm used is another example of the "parallel iteration" pattern common within SyncVal.  In this case we are
-// traversing the ordered range_map containing the AccessLog references and the ordered set of tags in use.
+// traversing the ordered range_map containing the AccessLog references and the ordered ranges of tags in use.
 //
 // To efficiently perform the parallel iteration, optimizations within this function include:
 //  * when ranges are detected that have no tags referenced, all ranges between the last tag and the current tag are erased
 //  * when used tags prior to the current range are found, all tags up to the current range are skipped
-//  * when a tag is found within the current range, that range is skipped (and thus kept in the map), and further used tags
-//    within the range are skipped.
+//  * when a used tag range overlaps the current range, that range is skipped (and thus kept in the map). As used_tags holds
+//    coalesced ranges, the used range is retained for comparison with the following map ranges.
 //
 // Note that for each subcase, any "next steps" logic is designed to be handled within the subsequent iteration -- meaning that
 // each subcase simply handles the specifics of the current update/skip/erase action needed, and leaves the iterators in a sensible
 // state for the top of loop... intentionally eliding special case handling.
 void BatchAccessLog::Trim(const ResourceUsageTagSet &used_tags) {
-    auto current_tag = used_tags.cbegin();
-    const auto end_tag = used_tags.cend();
+    auto current_used = used_tags.cbegin();
+    const auto end_used = used_tags.cend();
     auto current_map_range = log_map_.begin();
     const auto end_map = log_map_.end();
 
     while (current_map_range != end_map) {
-        if (current_tag == end_tag) {
+        if (current_used == end_used) {
             // We're out of tags, the rest of the map isn't referenced, so erase it
             current_map_range = log_map_.erase(current_map_range, end_map);
         } else {
             auto &range = current_map_range->first;
-            const ResourceUsageTag tag = *current_tag;
-            if (tag < range.begin) {
-                // Skip to the next tag potentially in range
-                // if this is end_tag, we'll handle that next iteration
-                current_tag = used_tags.lower_bound(range.begin);
-            } else if (tag >= range.end) {
-                // This tag is beyond the current range, delete all ranges between current_map_range,
-                // and the next that includes the tag.  Next is not erased.
-                auto next_used = log_map_.lower_bound(ResourceUsageRange(tag, tag + 1));
+            const ResourceUsageRange &used = *current_used;
+            if (used.end <= range.begin) {
+                // Skip to the next used range potentially overlapping
+                // if this is end_used, we'll handle that next iteration
+                current_used = used_tags.lower_bound(range.begin);
+            } else if (used.begin >= range.end) {
+                // These tags are beyond the current range, delete all ranges between current_map_range,
+                // and the next that includes the first of them.  Next is not erased.
+                auto next_used = log_map_.lower_bound(ResourceUsageRange(used.begin, used.begin + 1));
                 current_map_range = log_map_.erase(current_map_range, next_used);
             } else {
-                // Skip the rest of the tags in this range
-                // If this is end, the next iteration will handle
-                current_tag = used_tags.lower_bound(range.end);
-
-                // This is a range we will keep, advance to the next. Next iteration handles end condition
+                // This is a range we will keep, advance to the next. The used range may overlap it too, so is kept as is,
+                // the next iteration handles that and the end condition
                 ++current_map_range;
             }
         }
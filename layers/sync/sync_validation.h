@@ -156,11 +156,13 @@ struct FormatterImpl {
     FormatterImpl(const State &state_, const That &that_) : state(state_), that(that_) {}
 };
 
+// Every command records at least one of these (see ResourceCmdUsageRecord), so it is kept trivially copyable and small. The
+// names are always string literals, no need to copy them.
 struct NamedHandle {
-    const static size_t kInvalidIndex = std::numeric_limits<size_t>::max();
-    std::string name;
+    const static uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+    const char *name = nullptr;
     VulkanTypedHandle handle;
-    size_t index = kInvalidIndex;
+    uint32_t index = kInvalidIndex;
 
     using FormatterState = FormatterImpl<SyncValidator, NamedHandle>;
     // NOTE: CRTP could DRY this
@@ -169,11 +171,9 @@ struct NamedHandle {
     NamedHandle() = default;
     NamedHandle(const NamedHandle &other) = default;
     NamedHandle(NamedHandle &&other) = default;
-    NamedHandle(const std::string &name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
+    NamedHandle(const char *name_, const VulkanTypedHandle &handle_, uint32_t index_ = kInvalidIndex)
         : name(name_), handle(handle_), index(index_) {}
-    NamedHandle(const char *name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
-        : name(name_), handle(handle_), index(index_) {}
-    NamedHandle(const VulkanTypedHandle &handle_) : name(), handle(handle_) {}
+    NamedHandle(const VulkanTypedHandle &handle_) : handle(handle_) {}
     NamedHandle &operator=(const NamedHandle &other) = default;
     NamedHandle &operator=(NamedHandle &&other) = default;
 
@@ -243,9 +243,25 @@ struct ResourceUsageRecord : public ResourceCmdUsageRecord {
 
 // The resource tag index is relative to the command buffer or queue in which it's found
 using ResourceUsageTag = ResourceUsageRecord::TagIndex;
-using ResourceUsageTagSet = std::set<ResourceUsageTag>;
 using ResourceUsageRange = sparse_container::range<ResourceUsageTag>;
 
+// The tags still referenced by access state, used to trim the access logs. Tags are allocated in order and many accesses
+// share them, so rather than a set of every tag this is the sorted list of ranges of consecutive referenced tags.
+class ResourceUsageTagSet {
+  public:
+    using const_iterator = std::vector<ResourceUsageRange>::const_iterator;
+
+    void insert(ResourceUsageTag tag);
+
+    const_iterator cbegin() const { return ranges_.cbegin(); }
+    const_iterator cend() const { return ranges_.cend(); }
+    // The first range that includes tag or is after it
+    const_iterator lower_bound(ResourceUsageTag tag) const;
+
+  private:
+    std::vector<ResourceUsageRange> ranges_;
+};
+
 struct HazardResult {
     std::unique_ptr<const ResourceAccessState> access_state;
     std::unique_ptr<const ResourceFirstAccess> recorded_access;
@@ -534,6 +550,7 @@ class ResourceAccessState : public SyncStageAccess {
     bool ApplyPredicatedWait(Predicate &predicate);
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    ResourceUsageRange FirstAccessRange() const;
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
@@ -1011,10 +1028,19 @@ class AccessContext {
         AddressRange() = default;  // the explicit constructor below isn't needed in 20, but would delete the default.
         AddressRange(AccessAddressType type_, ResourceAccessRange range_) : type(type_), range(range_) {}
     };
-    using MapArray = std::array<ResourceAccessRangeMap, static_cast<size_t>(AccessAddressType::kTypeCount)>;
+    // The maps are shared between copies of a context, and copied on first modification, see GetAccessStateMap
+    using MapArray = std::array<std::shared_ptr<ResourceAccessRangeMap>, static_cast<size_t>(AccessAddressType::kTypeCount)>;
 
     using TrackBack = SubpassBarrierTrackback<AccessContext>;
 
+    // A recorded access state with first accesses, and the range of its address type it applies to
+    struct FirstUse {
+        AccessAddressType address_type;
+        ResourceAccessRange range;
+        const ResourceAccessState *access;
+    };
+    using FirstUses = std::vector<FirstUse>;
+
     template <typename Detector, typename RangeGen>
     HazardResult DetectHazard(AccessAddressType type, Detector &detector, RangeGen &range_gen, DetectOptions options) const;
     template <typename Detector, typename RangeGen>
@@ -1061,6 +1087,8 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                       const AccessContext &access_context) const;
+    // Called on the *active* context, for recorded first uses already culled to tag_range
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const FirstUses &first_uses) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -1071,7 +1099,11 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         for (auto &map : access_state_maps_) {
-            map.clear();
+            if (map && map.use_count() == 1) {
+                map->clear();
+            } else {
+                map = std::make_shared<ResourceAccessRangeMap>();
+            }
         }
     }
 
@@ -1121,6 +1153,7 @@ class AccessContext {
     void ResolveChildContexts(const std::vector<AccessContext> &contexts);
 
     void ImportAsyncContexts(const AccessContext &from);
+    void ShareAccessStateMaps(const AccessContext &from);
     template <typename Action, typename RangeGen>
     void ApplyUpdateAction(AccessAddressType address_type, const Action &action, RangeGen *range_gen_arg);
     template <typename Action>
@@ -1134,12 +1167,23 @@ class AccessContext {
 
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
+    // (Re)initialize as the context for subpass, reusing the storage of this context
+    void Init(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
+              const std::vector<AccessContext> &contexts, const AccessContext *external_context);
     void Trim();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) { return access_state_maps_[static_cast<size_t>(type)]; }
+    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) {
+        auto &map = access_state_maps_[static_cast<size_t>(type)];
+        assert(map);
+        if (map.use_count() > 1) {
+            // Copy on write, the map is still referenced by the context(s) this one was copied from or to
+            map = std::make_shared<ResourceAccessRangeMap>(*map);
+        }
+        return *map;
+    }
     const ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) const {
-        return access_state_maps_[static_cast<size_t>(type)];
+        return *access_state_maps_[static_cast<size_t>(type)];
     }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
@@ -1199,6 +1243,8 @@ class AccessContext {
                                    ResourceUsageTag async_tag) const;
     template <typename Detector>
     HazardResult DetectPreviousHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range) const;
+    bool HasAccess(AccessAddressType type, const ResourceAccessRange &range) const;
+    bool HasPreviousAccess(AccessAddressType type, const ResourceAccessRange &range) const;
     void UpdateAccessState(AccessAddressType type, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const ResourceAccessRange &range, ResourceUsageTag tag);
 
@@ -1305,6 +1351,11 @@ class RenderPassAccessContext {
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
     RenderPassAccessContext(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
                             const std::vector<const IMAGE_VIEW_STATE *> &attachment_views, const AccessContext *external_context);
+    // Reinitialization for a new render pass instance reuses the subpass contexts already allocated
+    void Init(const RENDER_PASS_STATE &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+              const std::vector<const IMAGE_VIEW_STATE *> &attachment_views, const AccessContext *external_context);
+    // Drops the recorded accesses and state object references, keeping the subpass contexts' allocations for Init
+    void Reset();
 
     bool ValidateDrawSubpassAttachment(const CommandExecutionContext &ex_context, const CMD_BUFFER_STATE &cmd_buffer,
                                        CMD_TYPE cmd_type) const;
@@ -1340,9 +1391,12 @@ class RenderPassAccessContext {
     };
     std::optional<ClearAttachmentInfo> GetClearAttachmentInfo(const VkClearAttachment &clear_attachment,
                                                               const VkClearRect &rect) const;
+    static void InitAttachmentViewGen(const VkRect2D &render_area, const std::vector<const IMAGE_VIEW_STATE *> &attachment_views,
+                                      AttachmentViewGenVector &view_gens);
+
   private:
     const RENDER_PASS_STATE *rp_state_;
-    const VkRect2D render_area_;
+    VkRect2D render_area_;
     uint32_t current_subpass_;
     std::vector<AccessContext> subpass_contexts_;
     AttachmentViewGenVector attachment_views_;
@@ -1433,8 +1487,12 @@ class CommandBufferAccessContext : public CommandExecutionContext {
           current_context_(&cb_access_context_),
           events_context_(),
           render_pass_contexts_(),
+          render_pass_context_pool_(),
           current_renderpass_context_(),
-          sync_ops_() {}
+          sync_ops_(),
+          first_use_segments_lock_(),
+          first_use_segments_built_(false),
+          first_use_segments_() {}
     CommandBufferAccessContext(SyncValidator &sync_validator, CMD_BUFFER_STATE *cb_state)
         : CommandBufferAccessContext(&sync_validator) {
         cb_state_ = cb_state;
@@ -1467,8 +1525,21 @@ class CommandBufferAccessContext : public CommandExecutionContext {
         subcommand_number_ = 0;
         reset_count_++;
         command_handles_.clear();
+        first_use_segments_built_ = false;
+        first_use_segments_.clear();
         cb_access_context_.Reset();
+        // Keep the render pass contexts for reuse by the next recording of this command buffer, as many as the last recording
+        // used. The older ones are at the front of the pool, and are dropped first.
+        const size_t pool_limit = render_pass_contexts_.size();
+        for (auto &rp_context : render_pass_contexts_) {
+            rp_context->Reset();
+            render_pass_context_pool_.emplace_back(std::move(rp_context));
+        }
         render_pass_contexts_.clear();
+        if (render_pass_context_pool_.size() > pool_limit) {
+            render_pass_context_pool_.erase(render_pass_context_pool_.begin(),
+                                            render_pass_context_pool_.end() - static_cast<std::ptrdiff_t>(pool_limit));
+        }
         current_context_ = &cb_access_context_;
         current_renderpass_context_ = nullptr;
         events_context_.Clear();
@@ -1504,6 +1575,9 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     void ResolveExecutedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
     HazardResult DetectFirstUseHazard(const ResourceUsageRange &tag_range) override;
+    // Called on the *recorded* context, see AccessContext::DetectFirstUseHazard
+    HazardResult DetectRecordedFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                              const AccessContext &access_context) const;
 
     VkQueueFlags GetQueueFlags() const { return cb_state_ ? cb_state_->GetQueueFlags() : 0; }
 
@@ -1572,8 +1646,21 @@ class CommandBufferAccessContext : public CommandExecutionContext {
 
     // Don't need the following for an active proxy cb context
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
+    std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_context_pool_;
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
+
+    // The recorded first uses for each of the tag ranges ValidateFirstUse checks (the ranges between sync ops), gathered by the
+    // first validation after recording ends so that each execution or submission doesn't search the whole access context once
+    // per range. Validation of different submissions or executions of the command buffer may run concurrently.
+    struct FirstUseSegment {
+        ResourceUsageRange tag_range;
+        AccessContext::FirstUses first_uses;
+    };
+    void BuildFirstUseSegments() const;
+    mutable std::shared_mutex first_use_segments_lock_;
+    mutable bool first_use_segments_built_;
+    mutable std::vector<FirstUseSegment> first_use_segments_;
 };
 
 namespace syncval_state {
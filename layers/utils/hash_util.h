@@ -18,11 +18,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <vector>
 #include "containers/custom_containers.h"
@@ -119,41 +122,132 @@ struct IsOrderedContainer {
 //       globally unique, invariant, nor repeatable from execution to
 //       execution.
 //
-// The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
-template <typename T, typename Hasher = vvl::hash<T>, typename KeyEqual = std::equal_to<T>>
+// The entries are split across independently locked shards, selected
+// by the hash of the value, so look ups of unrelated values from
+// different threads rarely contend. Look ups of values already in the
+// dictionary only take a read lock.
+//
+// The dictionary only keeps weak references to its entries. Once the
+// last Id of a value is released the entry expires and is reclaimed by
+// a later insert into the same shard, so the dictionary doesn't keep
+// growing in long running sessions. Looking up such a value again gives
+// a new Id, which is fine as nothing can still hold the old one.
+template <typename T, typename Hasher = vvl::hash<T>, typename KeyEqual = std::equal_to<T>, int SHARDSLOG2 = 4>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id look_up(U &&value) {
+        const size_t hash = Hasher()(value);
+        Shard &shard = shards_[ShardIndex(hash)];
+        {
+            ReadGuard g(shard.lock);
+            if (Id id = shard.Find(hash, value)) {
+                return id;
+            }
+        }
+
         // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
         Id from_input = std::make_shared<T>(std::forward<U>(value));
 
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        WriteGuard g(shard.lock);
+        // Another thread may have added the same value while no lock was held
+        if (Id id = shard.Find(hash, *from_input)) {
+            return id;
+        }
+        shard.Insert(hash, from_input);
+        return from_input;
+    }
+
+    // Number of entries still referenced by an Id
+    size_t size() const {
+        size_t count = 0;
+        for (const Shard &shard : shards_) {
+            ReadGuard g(shard.lock);
+            for (const auto &bucket : shard.entries) {
+                for (const auto &entry : bucket.second) {
+                    count += entry.expired() ? 0 : 1;
+                }
+            }
+        }
+        return count;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
-    };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    static constexpr int kShards = 1 << SHARDSLOG2;
+    // Expired entries are swept once the inserts since the last sweep reach the shard size, amortizing the sweep
+    // over the inserts. Small shards are not swept more often than this.
+    static constexpr size_t kMinSweepInterval = 64;
+
+    using WeakId = std::weak_ptr<const Def>;
+    using Lock = std::shared_mutex;
+    using ReadGuard = std::shared_lock<Lock>;
+    using WriteGuard = std::unique_lock<Lock>;
+
+    // 64 bytes to keep shards used by different threads on separate cache lines
+    struct alignas(64) Shard {
+        // Must hold at least a read lock
+        template <typename U>
+        Id Find(size_t hash, const U &value) const {
+            const auto it = entries.find(hash);
+            if (it == entries.end()) {
+                return nullptr;
+            }
+            for (const WeakId &entry : it->second) {
+                Id id = entry.lock();
+                if (id && KeyEqual()(*id, value)) {
+                    return id;
+                }
+            }
+            return nullptr;
+        }
+
+        // Must hold the write lock
+        void Insert(size_t hash, const Id &id) {
+            entries[hash].emplace_back(id);
+            if (++inserts_since_sweep >= std::max(kMinSweepInterval, entries.size())) {
+                Sweep();
+            }
+        }
+
+        // Drop the entries whose values are not referenced anymore
+        void Sweep() {
+            for (auto it = entries.begin(); it != entries.end();) {
+                auto &bucket = it->second;
+                uint32_t live = 0;
+                for (uint32_t i = 0; i < bucket.size(); ++i) {
+                    if (!bucket[i].expired()) {
+                        if (live != i) {
+                            bucket[live] = std::move(bucket[i]);
+                        }
+                        ++live;
+                    }
+                }
+                if (live == 0) {
+                    it = entries.erase(it);
+                } else {
+                    bucket.resize(live);
+                    ++it;
+                }
+            }
+            inserts_since_sweep = 0;
+        }
+
+        mutable Lock lock;
+        // Values with colliding hashes share a bucket
+        vvl::unordered_map<size_t, small_vector<WeakId, 1, uint32_t>> entries;
+        size_t inserts_since_sweep = 0;
     };
-    using Dict = vvl::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    static size_t ShardIndex(size_t hash) {
+        // Fold in the high bits, the low bits are also what the shard's own hash map uses
+        const uint64_t h = static_cast<uint64_t>(hash);
+        return static_cast<size_t>((h ^ (h >> 17) ^ (h >> 41)) & (kShards - 1));
+    }
+
+    std::array<Shard, kShards> shards_;
 };
 }  // namespace hash_util
@@ -216,6 +216,24 @@ constexpr T Align(T x, T p2) {
 // Returns the 0-based index of the LSB. An input mask of 0 yields -1
 static inline int LeastSignificantBit(uint32_t mask) { return u_ffs(static_cast<int>(mask)) - 1; }
 
+// Returns the 0-based index of the LSB of a 64 bit mask, like the x86 bit scan forward (bsf) instruction
+// Note: an input mask of 0 yields -1
+static inline int LeastSignificantBit64(uint64_t mask) {
+#if defined __GNUC__
+    return mask ? __builtin_ctzll(mask) : -1;
+#elif defined _MSC_VER && defined _WIN64
+    unsigned long bit_pos;
+    return _BitScanForward64(&bit_pos, mask) ? int(bit_pos) : -1;
+#else
+    for (int k = 0; k < 64; ++k) {
+        if (((mask >> k) & 1) != 0) {
+            return k;
+        }
+    }
+    return -1;
+#endif
+}
+
 template <typename FlagBits, typename Flags>
 FlagBits LeastSignificantFlag(Flags flags) {
     const int bit_shift = LeastSignificantBit(flags);
@@ -573,6 +591,8 @@ constexpr std::size_t get_hardware_destructive_interference_size() { return 64;
 // contains: Returns true if the key is in the map.
 // find: Returns != end() if found, value is in ret->second.
 // pop: Erases and returns the erased value if found.
+// visit: Calls a function on the value, if found, without copying it.
+// update: Calls a function to modify the value in place, inserting it first if needed.
 //
 // find/end: find returns a vaguely iterator-like type that can be compared to
 // end and can use iter->second to retrieve the reference. This is to ease porting
@@ -659,6 +679,35 @@ class vl_concurrent_unordered_map {
         }
     }
 
+    // Calls fn(const T &) with the element for key while holding the read lock, avoiding the copy made by find().
+    // Returns false if key isn't found.
+    template <typename Fn>
+    bool visit(const Key &key, Fn &&fn) const {
+        uint32_t h = ConcurrentMapHashObject(key);
+        ReadLockGuard lock(locks[h].lock);
+
+        auto itr = maps[h].find(key);
+        if (itr == maps[h].end()) return false;
+        fn(itr->second);
+        return true;
+    }
+
+    // Calls bool fn(T &) with the element for key while holding the write lock, default constructing the element if missing.
+    // The element is erased if fn returns false.
+    template <typename Fn>
+    void update(const Key &key, Fn &&fn) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        WriteLockGuard lock(locks[h].lock);
+
+        auto itr = maps[h].find(key);
+        if (itr == maps[h].end()) {
+            itr = maps[h].emplace(key, T()).first;
+        }
+        if (!fn(itr->second)) {
+            maps[h].erase(itr);
+        }
+    }
+
     FindResult pop(const Key &key) {
         uint32_t h = ConcurrentMapHashObject(key);
         WriteLockGuard lock(locks[h].lock);
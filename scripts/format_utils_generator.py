@@ -98,16 +98,6 @@ class FormatUtilsOutputGenerator(OutputGenerator):
         self.ycbcrFormats = dict()
         self.planarFormats = dict()
 
-        # Lots of switch statements share same ending
-        self.commonBoolSwitch  = '''        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
-}
-'''
-
     #
     # Called at beginning of processing as file is opened
     def beginFile(self, genOpts):
@@ -144,6 +134,8 @@ class FormatUtilsOutputGenerator(OutputGenerator):
         if self.sourceFile:
             write('#include "vk_format_utils.h"', file=self.outFile)
             write('#include "utils/vk_layer_utils.h"', file=self.outFile)
+            write('#include <array>', file=self.outFile)
+            write('#include <limits>', file=self.outFile)
             write('#include <vector>', file=self.outFile)
         elif self.headerFile:
             write('#pragma once', file=self.outFile)
@@ -260,6 +252,7 @@ extern "C" {
             index = int(plane.get('index'))
             self.maxPlaneCount = max(self.maxPlaneCount, (index + 1))
 
+        self.allFormats[formatName]['numericFormat'] = baseNumeric if sameNumeric else 'NONE'
         if sameNumeric:
             if baseNumeric not in self.numericFormats:
                 # create list if first time
@@ -267,6 +260,38 @@ extern "C" {
             self.numericFormats[baseNumeric].append(formatName)
 
     #
+    # Names of the FORMAT_PROPERTY_BITS, in bit order
+    def propertyBits(self):
+        bits = ['PACKED']
+        bits += ['COMPRESSED_{}'.format(key) for key in sorted(self.compressedFormats.keys())]
+        bits += ['YCBCR_CONVERSION', 'X_CHROMA_SUBSAMPLED', 'Y_CHROMA_SUBSAMPLED', 'SINGLE_PLANE_422']
+        return bits
+    #
+    # FORMAT_PROPERTY_BITS set for a format
+    def formatProperties(self, formatName):
+        bits = []
+        if formatName in self.packedFormats:
+            bits.append('PACKED')
+        for key in sorted(self.compressedFormats.keys()):
+            if formatName in self.compressedFormats[key]:
+                bits.append('COMPRESSED_{}'.format(key))
+        if formatName in self.ycbcrFormats:
+            chroma = self.ycbcrFormats[formatName]
+            bits.append('YCBCR_CONVERSION')
+            if chroma == '420' or chroma == '422':
+                bits.append('X_CHROMA_SUBSAMPLED')
+            if chroma == '420':
+                bits.append('Y_CHROMA_SUBSAMPLED')
+            if chroma == '422' and formatName not in self.planarFormats:
+                bits.append('SINGLE_PLANE_422')
+        if len(bits) == 0:
+            return '0'
+        return ' | '.join('FORMAT_PROPERTY_{}'.format(bit) for bit in bits)
+    #
+    # Numeric type shared by all components of a format, NONE if they differ
+    def numericFormat(self, formatName):
+        return self.allFormats[formatName]['numericFormat']
+    #
     # Create defines that are used either by other files (headerFile) or just internally (sourceFile)
     def defines(self):
         output = '\n'
@@ -289,46 +314,156 @@ struct COMPONENT_INFO {
     COMPONENT_TYPE type;
     uint32_t size; // bits
 
-    COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
-    COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
+    constexpr COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
+    constexpr COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
 };
 
+// Boolean properties of a format queried by the FormatIs* functions
+enum FORMAT_PROPERTY_BITS : uint32_t {
+'''
+            for index, name in enumerate(self.propertyBits()):
+                output += '    FORMAT_PROPERTY_{} = 1u << {},\n'.format(name, index)
+            output += '};\n'
+            output += 'static constexpr uint32_t FORMAT_PROPERTY_COMPRESSED =\n    '
+            output += ' | '.join('FORMAT_PROPERTY_COMPRESSED_{}'.format(key) for key in sorted(self.compressedFormats.keys()))
+            output += ';\n'
+            output += '''
 // Generic information for all formats
 struct FORMAT_INFO {
+    VkFormat format;
     FORMAT_COMPATIBILITY_CLASS compatibility;
     uint32_t block_size; // bytes
     uint32_t texel_per_block;
     VkExtent3D block_extent;
     uint32_t component_count;
     COMPONENT_INFO components[FORMAT_MAX_COMPONENTS];
+    FORMAT_NUMERICAL_TYPE numerical_type; // NONE if the components have different numerical types
+    uint32_t properties; // FORMAT_PROPERTY_BITS
+    uint32_t plane_count;
+    uint32_t depth_size; // bits
+    FORMAT_NUMERICAL_TYPE depth_numerical_type;
+    uint32_t stencil_size; // bits
+    FORMAT_NUMERICAL_TYPE stencil_numerical_type;
 };
 
-namespace std {
-template <>
-struct hash<VkFormat> {
-    size_t operator()(VkFormat fmt) const noexcept {
-        return hash<uint32_t>()(static_cast<uint32_t>(fmt));
-    }
-};
-}
-
+// VK_FORMAT_UNDEFINED must stay the first entry, it is returned for any unknown format
 // clang-format off
-static const vvl::unordered_map<VkFormat, FORMAT_INFO> kVkFormatTable = {
+static constexpr FORMAT_INFO kVkFormatTable[] = {
+    {VK_FORMAT_UNDEFINED, FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {},
+        FORMAT_NUMERICAL_TYPE::NONE, 0, 1, 0, FORMAT_NUMERICAL_TYPE::NONE, 0, FORMAT_NUMERICAL_TYPE::NONE},
 '''
             for f, info in sorted(self.allFormats.items()):
-                output += '    {{{},\n'.format(f)
-                output += '        {{FORMAT_COMPATIBILITY_CLASS::{}, {}, {}, {{{}}}, {},\n        {{'.format(
-                    info['class'], info['blockSize'], info['texelsPerBlock'], info['blockExtent'].replace(',', ', '), len(info['components']))
+                output += '    {{{}, FORMAT_COMPATIBILITY_CLASS::{}, {}, {}, {{{}}}, {},\n        {{'.format(
+                    f, info['class'], info['blockSize'], info['texelsPerBlock'], info['blockExtent'].replace(',', ', '), len(info['components']))
                 for index, component in enumerate(info['components']):
                     output += '{{COMPONENT_TYPE::{}, {}}}'.format(component['type'], component['bits'])
                     output += ', ' if (index + 1 != len(info['components'])) else ''
-                output += '} }},\n'
-
-            output += '    {VK_FORMAT_UNDEFINED, {FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {}}}'
+                output += '},\n'
+                depth = self.depthFormats.get(f, {'bits' : 0, 'numericFormat' : 'NONE'})
+                stencil = self.stencilFormats.get(f, {'bits' : 0, 'numericFormat' : 'NONE'})
+                output += '        FORMAT_NUMERICAL_TYPE::{}, {}, {}, {}, FORMAT_NUMERICAL_TYPE::{}, {}, FORMAT_NUMERICAL_TYPE::{}}},\n'.format(
+                    self.numericFormat(f), self.formatProperties(f), len(self.planarFormats.get(f, [None])),
+                    depth['bits'], depth['numericFormat'], stencil['bits'], stencil['numericFormat'])
             output += '};\n'
             output += '// clang-format on\n'
 
+            output += '''static_assert(kVkFormatTable[0].format == VK_FORMAT_UNDEFINED, "First format table entry must be VK_FORMAT_UNDEFINED");
+static_assert(std::size(kVkFormatTable) <= std::numeric_limits<uint16_t>::max(), "Format table index does not fit in uint16_t");
+
+// Formats before the first extension enum block (core 1.0 formats) are indexed directly by their enum value
+static constexpr uint32_t kExtensionFormatBase = 1000000000;
+
+static constexpr uint32_t CoreFormatCount() {
+    uint32_t count = 0;
+    for (const FORMAT_INFO &info : kVkFormatTable) {
+        const uint32_t value = static_cast<uint32_t>(info.format);
+        if (value < kExtensionFormatBase && value >= count) {
+            count = value + 1;
+        }
+    }
+    return count;
+}
+static constexpr uint32_t kCoreFormatCount = CoreFormatCount();
+
+// Holes in the core range map to index 0 (VK_FORMAT_UNDEFINED)
+static constexpr std::array<uint16_t, kCoreFormatCount> BuildCoreFormatIndex() {
+    std::array<uint16_t, kCoreFormatCount> index = {};
+    for (uint16_t i = 0; i < std::size(kVkFormatTable); ++i) {
+        const uint32_t value = static_cast<uint32_t>(kVkFormatTable[i].format);
+        if (value < kCoreFormatCount) {
+            index[value] = i;
+        }
+    }
+    return index;
+}
+static constexpr std::array<uint16_t, kCoreFormatCount> kCoreFormatIndex = BuildCoreFormatIndex();
+
+// Extension formats are found with a perfect hash (format % size), the size is the smallest one without collisions
+static constexpr uint32_t kMaxExtensionFormatHashSize = 1024;
+
+static constexpr uint32_t ExtensionFormatHashSize() {
+    // Each slot remembers the last hash size that claimed it, so it never needs to be cleared
+    std::array<uint32_t, kMaxExtensionFormatHashSize> claimed = {};
+    for (uint32_t size = 1; size <= kMaxExtensionFormatHashSize; ++size) {
+        bool collision = false;
+        for (const FORMAT_INFO &info : kVkFormatTable) {
+            const uint32_t value = static_cast<uint32_t>(info.format);
+            if (value < kExtensionFormatBase) {
+                continue;
+            }
+            if (claimed[value % size] == size) {
+                collision = true;
+                break;
+            }
+            claimed[value % size] = size;
+        }
+        if (!collision) {
+            return size;
+        }
+    }
+    return 0;
+}
+static constexpr uint32_t kExtensionFormatHashSize = ExtensionFormatHashSize();
+static_assert(kExtensionFormatHashSize != 0, "No perfect hash for the extension formats, increase kMaxExtensionFormatHashSize");
+
+static constexpr std::array<uint16_t, kExtensionFormatHashSize> BuildExtensionFormatIndex() {
+    std::array<uint16_t, kExtensionFormatHashSize> index = {};
+    for (uint16_t i = 0; i < std::size(kVkFormatTable); ++i) {
+        const uint32_t value = static_cast<uint32_t>(kVkFormatTable[i].format);
+        if (value >= kExtensionFormatBase) {
+            index[value % kExtensionFormatHashSize] = i;
+        }
+    }
+    return index;
+}
+static constexpr std::array<uint16_t, kExtensionFormatHashSize> kExtensionFormatIndex = BuildExtensionFormatIndex();
+
+// Returns the VK_FORMAT_UNDEFINED entry if the format is unknown
+static constexpr const FORMAT_INFO &GetFormatInfo(VkFormat format) {
+    const uint32_t value = static_cast<uint32_t>(format);
+    if (value < kCoreFormatCount) {
+        return kVkFormatTable[kCoreFormatIndex[value]];
+    }
+    const FORMAT_INFO &info = kVkFormatTable[kExtensionFormatIndex[value % kExtensionFormatHashSize]];
+    return (info.format == format) ? info : kVkFormatTable[0];
+}
+
+static_assert(GetFormatInfo(VK_FORMAT_R8G8B8A8_UNORM).format == VK_FORMAT_R8G8B8A8_UNORM, "Core format lookup is broken");
+static_assert(GetFormatInfo(VK_FORMAT_G8_B8R8_2PLANE_420_UNORM).format == VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,
+              "Extension format lookup is broken");
+static_assert(GetFormatInfo(VK_FORMAT_MAX_ENUM).format == VK_FORMAT_UNDEFINED, "Unknown format lookup is broken");
+'''
+
             output += '''
+namespace std {
+template <>
+struct hash<VkFormat> {
+    size_t operator()(VkFormat fmt) const noexcept {
+        return hash<uint32_t>()(static_cast<uint32_t>(fmt));
+    }
+};
+}
+
 struct PER_PLANE_COMPATIBILITY {
     uint32_t width_divisor;
     uint32_t height_divisor;
@@ -406,11 +541,8 @@ static inline bool FormatIsSampledFloat(VkFormat format) {
             for key in self.numericFormats.keys():
                 output += '\n// Return true if all components in the format are an {}\n'.format(key)
                 output += 'bool FormatIs{}(VkFormat format) {{\n'.format(key)
-                output += '    bool found = false;\n'
-                output += '    switch (format) {\n'
-                for f in self.numericFormats[key]:
-                    output += '        case {}:\n'.format(f)
-                output += self.commonBoolSwitch
+                output += '    return GetFormatInfo(format).numerical_type == FORMAT_NUMERICAL_TYPE::{};\n'.format(key)
+                output += '}\n'
 
         return output;
     #
@@ -427,18 +559,12 @@ static inline bool FormatIsSampledFloat(VkFormat format) {
             for key in sorted(self.compressedFormats.keys()):
                 output += '\n// Return true if the format is a {} compressed image format\n'.format(key)
                 output += 'bool FormatIsCompressed_{}(VkFormat format) {{\n'.format(key)
-                output += '    bool found = false;\n'
-                output += '    switch (format) {\n'
-                for f in sorted(self.compressedFormats[key]):
-                    output += '        case {}:\n'.format(f)
-                output += self.commonBoolSwitch
+                output += '    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED_{}) != 0;\n'.format(key)
+                output += '}\n'
 
             output += '\n// Return true if the format is any compressed image format\n'
             output += 'bool FormatIsCompressed(VkFormat format) {\n'
-            output += '    return (\n'
-            for index, key in enumerate(sorted(self.compressedFormats.keys()), start=1):
-                output += '      FormatIsCompressed_{}(format)'.format(key)
-                output += ' ||\n' if (index != len(self.compressedFormats.keys())) else ');\n'
+            output += '    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_COMPRESSED) != 0;\n'
             output += '}\n'
 
         return output;
@@ -460,111 +586,45 @@ FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format);
 FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format);
 '''
         elif self.sourceFile:
-            output += '\n// Return true if format is a depth OR stencil format\n'
-            output += 'bool FormatIsDepthOrStencil(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.allFormats.keys()):
-                if f in self.depthFormats.keys() or f in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a depth AND stencil format\n'
-            output += 'bool FormatIsDepthAndStencil(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.depthFormats.keys()):
-                if f in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a depth ONLY format\n'
-            output += 'bool FormatIsDepthOnly(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.depthFormats.keys()):
-                if f not in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a stencil ONLY format\n'
-            output += 'bool FormatIsStencilOnly(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.stencilFormats.keys()):
-                if f not in self.depthFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Returns size of depth component in bits'
-            output += '\n// Returns zero if no depth component\n'
-            output += 'uint32_t FormatDepthSize(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            # sorts case statments together with same return value
-            used = []
-            for key, value in sorted(self.depthFormats.items()):
-                if key not in used:
-                    for key_dup, value_dup in sorted(self.depthFormats.items()):
-                        if value_dup['bits'] == value['bits']:
-                            used.append(key_dup)
-                            output += '           case {}:\n'.format(key_dup)
-                    output += '            return {};\n'.format(value['bits'])
-            output += '        default:\n'
-            output += '            return 0;\n'
-            output += '     }\n'
-            output += '}\n'
+            output += '''
+// Return true if format is a depth OR stencil format
+bool FormatIsDepthOrStencil(VkFormat format) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) || (info.stencil_size != 0);
+}
 
-            output += '\n// Returns size of stencil component in bits'
-            output += '\n// Returns zero if no stencil component\n'
-            output += 'uint32_t FormatStencilSize(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            # sorts case statments together with same return value
-            used = []
-            for key, value in sorted(self.stencilFormats.items()):
-                if key not in used:
-                    for key_dup, value_dup in sorted(self.stencilFormats.items()):
-                        if value_dup['bits'] == value['bits']:
-                            used.append(key_dup)
-                            output += '           case {}:\n'.format(key_dup)
-                    output += '            return {};\n'.format(value['bits'])
-            output += '        default:\n'
-            output += '            return 0;\n'
-            output += '     }\n'
-            output += '}\n'
+// Return true if format is a depth AND stencil format
+bool FormatIsDepthAndStencil(VkFormat format) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) && (info.stencil_size != 0);
+}
 
-            output += '\n// Returns NONE if no depth component\n'
-            output += 'FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            # sorts case statments together with same return value
-            used = []
-            for key, value in sorted(self.depthFormats.items()):
-                if key not in used:
-                    for key_dup, value_dup in sorted(self.depthFormats.items()):
-                        if value_dup['numericFormat'] == value['numericFormat']:
-                            used.append(key_dup)
-                            output += '           case {}:\n'.format(key_dup)
-                    output += '            return FORMAT_NUMERICAL_TYPE::{};\n'.format(value['numericFormat'])
-            output += '        default:\n'
-            output += '            return FORMAT_NUMERICAL_TYPE::NONE;\n'
-            output += '     }\n'
-            output += '}\n'
+// Return true if format is a depth ONLY format
+bool FormatIsDepthOnly(VkFormat format) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size != 0) && (info.stencil_size == 0);
+}
 
-            output += '\n// Returns NONE if no stencil component\n'
-            output += 'FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            # sorts case statments together with same return value
-            used = []
-            for key, value in sorted(self.stencilFormats.items()):
-                if key not in used:
-                    for key_dup, value_dup in sorted(self.stencilFormats.items()):
-                        if value_dup['numericFormat'] == value['numericFormat']:
-                            used.append(key_dup)
-                            output += '           case {}:\n'.format(key_dup)
-                    output += '            return FORMAT_NUMERICAL_TYPE::{};\n'.format(value['numericFormat'])
-            output += '        default:\n'
-            output += '            return FORMAT_NUMERICAL_TYPE::NONE;\n'
-            output += '     }\n'
-            output += '}\n'
+// Return true if format is a stencil ONLY format
+bool FormatIsStencilOnly(VkFormat format) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return (info.depth_size == 0) && (info.stencil_size != 0);
+}
+
+// Returns size of depth component in bits
+// Returns zero if no depth component
+uint32_t FormatDepthSize(VkFormat format) { return GetFormatInfo(format).depth_size; }
+
+// Returns size of stencil component in bits
+// Returns zero if no stencil component
+uint32_t FormatStencilSize(VkFormat format) { return GetFormatInfo(format).stencil_size; }
+
+// Returns NONE if no depth component
+FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format) { return GetFormatInfo(format).depth_numerical_type; }
+
+// Returns NONE if no stencil component
+FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format) { return GetFormatInfo(format).stencil_numerical_type; }
+'''
 
         return output;
     #
@@ -576,13 +636,10 @@ FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format);
 bool FormatIsPacked(VkFormat format);
 '''
         elif self.sourceFile:
-            output += '\n// Return true if format is a packed format\n'
-            output += 'bool FormatIsPacked(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in self.packedFormats:
-                output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '''
+// Return true if format is a packed format
+bool FormatIsPacked(VkFormat format) { return (GetFormatInfo(format).properties & FORMAT_PROPERTY_PACKED) != 0; }
+'''
 
         return output;
     #
@@ -596,31 +653,22 @@ bool FormatIsXChromaSubsampled(VkFormat format);
 bool FormatIsYChromaSubsampled(VkFormat format);
 '''
         elif self.sourceFile:
-            output += '\n// Return true if format requires sampler YCBCR conversion\n'
-            output += '// for VK_IMAGE_ASPECT_COLOR_BIT image views\n'
-            output += '// Table found in spec\n'
-            output += 'bool FormatRequiresYcbcrConversion(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\nbool FormatIsXChromaSubsampled(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '420' or self.ycbcrFormats[f] == '422':
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\nbool FormatIsYChromaSubsampled(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '420':
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '''
+// Return true if format requires sampler YCBCR conversion
+// for VK_IMAGE_ASPECT_COLOR_BIT image views
+// Table found in spec
+bool FormatRequiresYcbcrConversion(VkFormat format) {
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_YCBCR_CONVERSION) != 0;
+}
+
+bool FormatIsXChromaSubsampled(VkFormat format) {
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_X_CHROMA_SUBSAMPLED) != 0;
+}
+
+bool FormatIsYChromaSubsampled(VkFormat format) {
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_Y_CHROMA_SUBSAMPLED) != 0;
+}
+'''
 
         return output;
     #
@@ -636,27 +684,15 @@ VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plan
 VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect);
 '''
         elif self.sourceFile:
-            output += '\n// Single-plane "_422" formats are treated as 2x1 compressed (for copies)\n'
-            output += '\nbool FormatIsSinglePlane_422(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '422' and f not in self.planarFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Returns number of planes in format (which is 1 by default)\n'
-            output += 'uint32_t FormatPlaneCount(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            for i in range(2, self.maxPlaneCount + 1):
-                for f in sorted(self.planarFormats.keys()):
-                    if len(self.planarFormats[f]) == i:
-                        output += '        case {}:\n'.format(f)
-                output += '            return {};\n'.format(i)
-            output += '        default:\n'
-            output += '            return 1;\n'
-            output += '     }\n'
-            output += '}\n'
+            output += '''
+// Single-plane "_422" formats are treated as 2x1 compressed (for copies)
+bool FormatIsSinglePlane_422(VkFormat format) {
+    return (GetFormatInfo(format).properties & FORMAT_PROPERTY_SINGLE_PLANE_422) != 0;
+}
+
+// Returns number of planes in format (which is 1 by default)
+uint32_t FormatPlaneCount(VkFormat format) { return GetFormatInfo(format).plane_count; }
+'''
 
             output += '''
 // Will return VK_FORMAT_UNDEFINED if given a plane aspect that doesn't exist for the format
@@ -707,29 +743,17 @@ bool FormatHasAlpha(VkFormat format);
 '''
         elif self.sourceFile:
             output += '''
-uint32_t FormatComponentCount(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.component_count;
-    }
-    return 0;
-}
+uint32_t FormatComponentCount(VkFormat format) { return GetFormatInfo(format).component_count; }
 
 VkExtent3D FormatTexelBlockExtent(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.block_extent;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    if (info.format == format) {
+        return info.block_extent;
     }
     return {1, 1, 1};
 }
 
-FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.compatibility;
-    }
-    return FORMAT_COMPATIBILITY_CLASS::NONE;
-}
+FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) { return GetFormatInfo(format).compatibility; }
 
 // Return true if format is 'normal', with one texel per format element
 bool FormatElementIsTexel(VkFormat format) {
@@ -754,11 +778,7 @@ uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags aspectMask) {
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.block_size;
-    }
-    return 0;
+    return GetFormatInfo(format).block_size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -774,22 +794,18 @@ double FormatTexelSize(VkFormat format, VkImageAspectFlags aspectMask) {
 }
 
 bool FormatHasComponentSize(VkFormat format, uint32_t size) {
-    auto item = kVkFormatTable.find(format);
-    if (item == kVkFormatTable.end()) {
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    if (info.format != format) {
         return false;
     }
-    const COMPONENT_INFO* begin = item->second.components;
-    const COMPONENT_INFO* end = item->second.components + FORMAT_MAX_COMPONENTS;
+    const COMPONENT_INFO* begin = info.components;
+    const COMPONENT_INFO* end = info.components + FORMAT_MAX_COMPONENTS;
     return std::find_if(begin, end, [size](const COMPONENT_INFO& info) { return info.size == size; }) != end;
 }
 
 static bool FormatHasComponentType(VkFormat format, COMPONENT_TYPE component) {
-    auto item = kVkFormatTable.find(format);
-    if (item == kVkFormatTable.end()) {
-        return false;
-    }
-    const COMPONENT_INFO* begin = item->second.components;
-    const COMPONENT_INFO* end = item->second.components + FORMAT_MAX_COMPONENTS;
+    const COMPONENT_INFO* begin = GetFormatInfo(format).components;
+    const COMPONENT_INFO* end = begin + FORMAT_MAX_COMPONENTS;
     return std::find_if(begin, end, [component](const COMPONENT_INFO& info) { return info.type == component; }) != end;
 }
 
@@ -1572,8 +1572,9 @@ static void DeviceExtensionWarnlist(ValidationObject *layer_data, const VkDevice
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
         };
 
+        // Returns true if value is a core value of the enumerated type T, or one added by an enabled extension
         template <typename T>
-        std::vector<T> ValidParamValues() const;
+        bool IsValidEnumValue(T value) const;
 """
 
     inline_custom_source_postamble = """
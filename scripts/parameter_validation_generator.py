@@ -961,35 +961,9 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                                     enum_map_key = enum_map_key.union(self.extension_enums[name])
 
                             for k in sorted(enum_map_key):
-                                if k not in enum_entry_map:
-                                    enum_entry_map[k] = f'{name}, '
-                                else:
-                                    enum_entry_map[k] += f'{name}, '
+                                enum_entry_map.setdefault(k, []).append(name)
                     if alias is None:
-                        enum_entry += f'''
-template<>
-std::vector<{groupName}> ValidationObject::ValidParamValues() const {{
-    // TODO (ncesario) This is not ideal as we compute the enabled extensions every time this function is called.
-    //      Ideally "values" would be something like a static variable that is built once and this function returns
-    //      a span of the container. This does not work for applications which create and destroy many instances and
-    //      devices over the lifespan of the project (e.g., VLT).
-    constexpr std::array Core{groupName}Enums = {{ {enum_entry_map["core"]} }};
-    static const vvl::unordered_map<const ExtEnabled DeviceExtensions::*, std::vector<{groupName}>> Extended{groupName}Enums = {{\n'''
-                        for k,v in enum_entry_map.items():
-                            if k != 'core':
-                                enum_entry += f'        {{ &DeviceExtensions::{k.lower()}, {{ {v} }} }},\n'
-                        enum_entry += f'''    }};
-    std::vector<{groupName}> values(Core{groupName}Enums.cbegin(), Core{groupName}Enums.cend());
-    std::set<{groupName}> unique_exts;
-    for (const auto& [extension, enums]: Extended{groupName}Enums) {{
-        if (IsExtEnabled(device_extensions.*extension)) {{
-            unique_exts.insert(enums.cbegin(), enums.cend());
-        }}
-    }}
-    std::copy(unique_exts.cbegin(), unique_exts.cend(), std::back_inserter(values));
-    return values;
-}}
-'''
+                        enum_entry += self.genEnumValueCheck(groupName, enum_entry_map)
                     if self.featureExtraProtect is not None:
                         enum_entry += '\n#endif // %s' % self.featureExtraProtect
                     self.enum_values_definitions[groupName] = enum_entry
@@ -1000,9 +974,45 @@ std::vector<{groupName}> ValidationObject::ValidParamValues() const {{
                 isEnum = ('FLAG_BITS' not in expandName)
                 if isEnum and alias is None:
                     if self.featureExtraProtect is not None: self.specializations += [ f'#ifdef {self.featureExtraProtect}'  ]
-                    self.specializations += [ f'template<> std::vector<{groupName}> ValidationObject::ValidParamValues() const;' ]
+                    self.specializations += [ f'template<> bool ValidationObject::IsValidEnumValue({groupName} value) const;' ]
                     if self.featureExtraProtect is not None: self.specializations += [ f'#endif // {self.featureExtraProtect}'  ]
     #
+    # Generate the IsValidEnumValue specialization for an enumerated type.  enum_entry_map maps 'core' or the name of an
+    # extension to the values it provides.  The switch is built into a jump table by the compiler, so checking a value needs
+    # neither a list of the enabled values nor a search through it; values added by extensions are only valid when one of the
+    # extensions providing them is enabled.
+    def genEnumValueCheck(self, groupName, enum_entry_map):
+        value_extensions = dict()
+        for k, names in enum_entry_map.items():
+            for name in names:
+                value_extensions.setdefault(name, []).append(k)
+        # Group the values by the set of extensions providing them, in order of first appearance
+        value_groups = dict()
+        for k, names in enum_entry_map.items():
+            for name in names:
+                group = value_groups.setdefault(tuple(value_extensions[name]), [])
+                if name not in group:
+                    group.append(name)
+        enum_check = f'''
+template<>
+bool ValidationObject::IsValidEnumValue({groupName} value) const {{
+    switch (value) {{
+'''
+        for extensions, names in value_groups.items():
+            for name in names:
+                enum_check += f'        case {name}:\n'
+            if 'core' in extensions:
+                enum_check += '            return true;\n'
+            else:
+                enabled = ' || '.join([f'IsExtEnabled(device_extensions.{k.lower()})' for k in extensions])
+                enum_check += f'            return {enabled};\n'
+        enum_check += '''        default:
+            return false;
+    }
+}
+'''
+        return enum_check
+    #
     # Capture command parameter info to be used for param check code generation.
     def genCmd(self, cmdinfo, name, alias):
         # record the name/alias pair
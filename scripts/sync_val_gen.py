@@ -740,6 +740,20 @@ def StageAccessEnums(stage_accesses, config):
 def UnpackField(map, field='name'):
     return [ e[field] for e in map ]
 
+def CrossReferenceEntries(key_vec, mask_map, indent):
+    entries = []
+    for mask_key in key_vec:
+        mask_vec = mask_map[mask_key]
+        if len(mask_vec) == 0:
+            continue
+
+        if len(mask_vec) > 1:
+            sep = ' |\n' + indent * 2
+            entries.append( '{tab}{{ {}, (\n{tab}{tab}{}\n{tab})}},'.format(mask_key, sep.join(mask_vec), tab=indent))
+        else:
+            entries.append( '{}{{ {}, {}}},'.format(indent, mask_key, mask_vec[0]))
+    return entries
+
 def CrossReferenceTable(table_name, table_desc, key_type, mapped_type, key_vec, mask_map, config):
     indent = config['indent']
 
@@ -748,16 +762,7 @@ def CrossReferenceTable(table_name, table_desc, key_type, mapped_type, key_vec,
     if config['is_source']:
         table.append('const {}& {}() {{'.format(typename, config['var_prefix'] + table_name))
         table.append('{}static const {} variable = {{'.format(indent, typename))
-        for mask_key in key_vec:
-            mask_vec = mask_map[mask_key]
-            if len(mask_vec) == 0:
-                continue
-
-            if len(mask_vec) > 1:
-                sep = ' |\n' + indent * 2
-                table.append( '{tab}{{ {}, (\n{tab}{tab}{}\n{tab})}},'.format(mask_key, sep.join(mask_vec), tab=indent))
-            else:
-                table.append( '{}{{ {}, {}}},'.format(indent, mask_key, mask_vec[0]))
+        table.extend(CrossReferenceEntries(key_vec, mask_map, indent))
         if(table_name == 'StageAccessMaskByAccessBit'):
             table.append( '{}{{ {}, {}}},'.format(indent, 'VK_ACCESS_2_MEMORY_READ_BIT', 'syncStageAccessReadMask'))
             table.append( '{}{{ {}, {}}},'.format(indent, 'VK_ACCESS_2_MEMORY_WRITE_BIT', 'syncStageAccessWriteMask'))
@@ -770,6 +775,61 @@ def CrossReferenceTable(table_name, table_desc, key_type, mapped_type, key_vec,
 
     return table
 
+# Single bit keyed table as a constexpr array indexed by the bit position of the key, for lookup without a search
+def BitIndexTable(table_name, table_desc, key_type, mapped_type, key_vec, mask_map, config):
+    indent = config['indent']
+
+    table = ['// ' + table_desc + ', indexed by bit position']
+    typename = 'std::array<{}, {}>'.format(mapped_type, config['bit_index_size'])
+    if config['is_source']:
+        table.append('const {}& {}ByBitIndex() {{'.format(typename, config['var_prefix'] + table_name))
+        table.append('{}static constexpr std::pair<{}, {}> entries[] = {{'.format(indent, key_type, mapped_type))
+        table.extend(CrossReferenceEntries(key_vec, mask_map, indent))
+        table.append('{}}};'.format(indent))
+        table.append('{}static constexpr {} variable = {}BitIndexTable<{}>(entries);'.format(indent, typename, config['var_prefix'],
+                                                                                               mapped_type))
+        table.append('{}return variable;'.format(indent))
+        table.append('}')
+    else:
+        table.append('const {}& {}ByBitIndex();'.format(typename, config['var_prefix'] + table_name))
+    table.append('')
+
+    return table
+
+# As BitIndexTable, for mapped types without constexpr operations, built once from the std::map version of the table
+def BitIndexTableFromMap(table_name, index_name, table_desc, mapped_type, config):
+    indent = config['indent']
+
+    table = ['// ' + table_desc + ', indexed by bit position']
+    typename = 'std::array<{}, {}>'.format(mapped_type, config['bit_index_size'])
+    if config['is_source']:
+        table.append('const {}& {}() {{'.format(typename, config['var_prefix'] + index_name))
+        table.append('{}static const {} variable = {var_prefix}BitIndexTable<{}>({var_prefix}{}());'.format(
+            indent, typename, mapped_type, table_name, **config))
+        table.append('{}return variable;'.format(indent))
+        table.append('}')
+    else:
+        table.append('const {}& {}();'.format(typename, config['var_prefix'] + index_name))
+    table.append('')
+
+    return table
+
+def BitIndexTableHelper(config):
+    output = ['// Converts a table keyed by single bit flags to an array indexed by bit position',
+              'template <typename Value, typename Entries>',
+              'constexpr std::array<Value, {bit_index_size}> {var_prefix}BitIndexTable(const Entries &entries) {{'.format(**config),
+              '{indent}std::array<Value, {bit_index_size}> table{{}};'.format(**config),
+              '{indent}for (const auto &entry : entries) {{'.format(**config),
+              '{indent}{indent}if (!entry.first) continue;'.format(**config),
+              '{indent}{indent}size_t index = 0;'.format(**config),
+              '{indent}{indent}while ((entry.first >> index) > 1) ++index;'.format(**config),
+              '{indent}{indent}table[index] = entry.second;'.format(**config),
+              '{indent}}}'.format(**config),
+              '{indent}return table;'.format(**config),
+              '}',
+              '']
+    return output
+
 def DoubleCrossReferenceTable(table_name, table_desc, stage_keys, access_keys, stage_access_stage_access_map, config):
     indent = config['indent']
     ordinal_name = config['ordinal_name']
@@ -824,6 +884,7 @@ def StageAccessCrossReference(enum_in_bit_order, stage_access_combinations, conf
     sas_name = 'StageAccessMaskByStageBit'
     output.extend(CrossReferenceTable(sas_name, sas_desc, 'VkPipelineStageFlags2', config['sync_mask_name'],
                                       UnpackField(stages_in_bit_order), stage_access_mask_stage_map, config))
+    output.extend(BitIndexTableFromMap(sas_name, 'StageAccessMaskByStageBitIndex', sas_desc, config['sync_mask_name'], config))
 
     # saa -- stage_access by access used to build up SyncMaskTypes from VkAccessFlagBits
     saa_name = 'StageAccessMaskByAccessBit'
@@ -842,6 +903,8 @@ def StageAccessCrossReference(enum_in_bit_order, stage_access_combinations, conf
     direct_desc = 'Direct VkPipelineStageFlags to valid VkAccessFlags lookup table'
     output.extend(CrossReferenceTable(direct_name, direct_desc, 'VkPipelineStageFlags2', 'VkAccessFlags2',
                                       UnpackField(stages_in_bit_order), direct_stage_to_access_map, config))
+    output.extend(BitIndexTable(direct_name, direct_desc, 'VkPipelineStageFlags2', 'VkAccessFlags2',
+                                UnpackField(stages_in_bit_order), direct_stage_to_access_map, config))
 
     return output
 
@@ -900,11 +963,15 @@ def PipelineOrderMaskMap(stage_order, stage_order_map, config):
     prior_desc = 'Masks of logically earlier stage flags for a given stage flag'
     output.extend(CrossReferenceTable(prior_name, prior_desc, config['vk_stage_bits'], config['vk_stage_flags'], stage_order,
                                      stage_order_map['prior'], config))
+    output.extend(BitIndexTable(prior_name, prior_desc, config['vk_stage_bits'], config['vk_stage_flags'], stage_order,
+                                stage_order_map['prior'], config))
 
     subseq_name = 'LogicallyLaterStages'
     subseq_desc = 'Masks of logically later stage flags for a given stage flag'
     output.extend(CrossReferenceTable(subseq_name, subseq_desc, config['vk_stage_bits'], config['vk_stage_flags'], stage_order,
                                      stage_order_map['subseq'], config))
+    output.extend(BitIndexTable(subseq_name, subseq_desc, config['vk_stage_bits'], config['vk_stage_flags'], stage_order,
+                                stage_order_map['subseq'], config))
 
     order_name = 'StageOrder'
     order_desc = 'Lookup table of stage orderings'
@@ -962,6 +1029,7 @@ def GenSyncTypeHelper(gen, is_source) :
         'vk_stage_bits': 'VkPipelineStageFlags2',
         'vk_access_flags': 'VkAccessFlags2',
         'vk_access_bits': 'VkAccessFlags2',
+        'bit_index_size': 64,
         'is_source': is_source}
     config['sync_mask_name'] = '{}StageAccessFlags'.format(config['type_prefix'])
     config['ordinal_name'] = '{}StageAccessIndex'.format(config['type_prefix'])
@@ -980,6 +1048,7 @@ def GenSyncTypeHelper(gen, is_source) :
     if not config['is_source']:
         lines.extend(DeclareFauxConst(enums_in_bit_order))
         lines.append('')
+        lines.extend(BitIndexTableHelper(config))
 
 
     stage_order = pipeline_order.split()
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 The Khronos Group Inc.
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "utils/hash_util.h"
+
+#include <thread>
+#include <vector>
+
+using IntVectorDict = hash_util::Dictionary<std::vector<int>, hash_util::IsOrderedContainer<std::vector<int>>>;
+
+TEST(CustomContainer, DictionarySameContentSameId) {
+    IntVectorDict dict;
+    const auto a = dict.look_up(std::vector<int>{1, 2, 3});
+    const std::vector<int> b_value = {1, 2, 3};
+    const auto b = dict.look_up(b_value);
+    const auto c = dict.look_up(std::vector<int>{3, 2, 1});
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(*c, std::vector<int>({3, 2, 1}));
+    ASSERT_EQ(dict.size(), 2u);
+}
+
+TEST(CustomContainer, DictionaryReclaimsUnreferencedEntries) {
+    IntVectorDict dict;
+    const auto kept = dict.look_up(std::vector<int>{-1});
+    for (int i = 0; i < 10000; ++i) {
+        // The returned Id is released immediately
+        dict.look_up(std::vector<int>{i});
+    }
+    ASSERT_EQ(dict.size(), 1u);
+    ASSERT_EQ(dict.look_up(std::vector<int>{-1}), kept);
+}
+
+TEST(CustomContainer, DictionaryConcurrentLookUp) {
+    IntVectorDict dict;
+    constexpr int kThreads = 4;
+    constexpr int kValues = 1000;
+    std::vector<std::vector<IntVectorDict::Id>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&dict, &ids, t]() {
+            for (int i = 0; i < kValues; ++i) {
+                ids[t].emplace_back(dict.look_up(std::vector<int>{i, i + 1}));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int t = 1; t < kThreads; ++t) {
+        ASSERT_EQ(ids[0], ids[t]);
+    }
+    ASSERT_EQ(dict.size(), static_cast<size_t>(kValues));
+}
@@ -493,6 +493,59 @@ TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesTest
     best_ibo.memory().unmap();
 }
 
+TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesUpdatedTest) {
+    TEST_DESCRIPTION(
+        "Test that index buffer scans are not reused for draws after the application rewrote the mapped index buffer.");
+
+    InitBestPracticesFramework(kEnableArmValidation);
+    InitState();
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    if (IsPlatform(kMockICD)) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    std::vector<uint16_t> worst_indices(128 * 16);
+    std::vector<uint16_t> best_indices(128 * 16);
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = 0; j < 128; j++) {
+            worst_indices[j + i * 128] = j;
+            best_indices[i + j * 16] = j;
+        }
+    }
+
+    VkConstantBufferObj ibo(m_device, worst_indices.size() * sizeof(uint16_t), worst_indices.data(),
+                            VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    m_commandBuffer->BindIndexBuffer(&ibo, static_cast<VkDeviceSize>(0), VK_INDEX_TYPE_UINT16);
+
+    // the index buffer stays mapped, drawing it several times must keep reporting the same result
+    auto* data = static_cast<uint16_t*>(ibo.memory().map());
+    for (uint32_t i = 0; i < 3; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
+                                             "UNASSIGNED-BestPractices-vkCmdDrawIndexed-post-transform-cache-thrashing");
+        m_commandBuffer->DrawIndexed(worst_indices.size(), 0, 0, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+
+    // rewriting the persistently mapped memory must not reuse the previous scan
+    std::copy(best_indices.begin(), best_indices.end(), data);
+    m_commandBuffer->DrawIndexed(best_indices.size(), 0, 0, 0, 0);
+    ibo.memory().unmap();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkArmBestPracticesLayerTest, PresentModeTest) {
     TEST_DESCRIPTION("Test for usage of Presentation Modes");
 
@@ -1174,3 +1174,64 @@ TEST_F(VkLayerTest, InvalidMixingProtectedResources) {
     vk::FreeMemory(device(), memory_protected, nullptr);
     vk::FreeMemory(device(), memory_unprotected, nullptr);
 }
+
+TEST_F(VkLayerTest, DrawIndexedAfterBindingProtectedIndexBuffer) {
+    TEST_DESCRIPTION("Draw, then bind a protected index buffer in an unprotected command buffer and draw again");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    auto protected_memory_features = LvlInitStruct<VkPhysicalDeviceProtectedMemoryFeatures>();
+    auto features2 = GetPhysicalDeviceFeatures2(protected_memory_features);
+    if (protected_memory_features.protectedMemory == VK_FALSE) {
+        GTEST_SKIP() << "protectedMemory feature not supported";
+    }
+    auto protected_memory_properties = LvlInitStruct<VkPhysicalDeviceProtectedMemoryProperties>();
+    GetPhysicalDeviceProperties2(protected_memory_properties);
+    if (protected_memory_properties.protectedNoFault) {
+        GTEST_SKIP() << "protectedNoFault is supported";
+    }
+
+    // m_commandBuffer is an unprotected command buffer
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    auto buffer_create_info = VkBufferObj::create_info(1024, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+    VkBufferObj index_buffer;
+    index_buffer.init(*m_device, buffer_create_info);
+
+    buffer_create_info.flags = VK_BUFFER_CREATE_PROTECTED_BIT;
+    VkBufferObj protected_index_buffer;
+    protected_index_buffer.init_no_mem(*m_device, buffer_create_info);
+    auto alloc_info = LvlInitStruct<VkMemoryAllocateInfo>();
+    const VkMemoryRequirements mem_reqs = protected_index_buffer.memory_requirements();
+    alloc_info.allocationSize = mem_reqs.size;
+    if (!m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, VK_MEMORY_PROPERTY_PROTECTED_BIT)) {
+        GTEST_SKIP() << "No protected memory type found";
+    }
+    vk_testing::DeviceMemory protected_memory(*m_device, alloc_info);
+    protected_index_buffer.bind_memory(protected_memory, 0);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    ASSERT_VK_SUCCESS(pipe.CreateGraphicsPipeline());
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindIndexBuffer(m_commandBuffer->handle(), index_buffer.handle(), 0, VK_INDEX_TYPE_UINT16);
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), 1, 1, 0, 0, 0);
+
+    // Nothing but the index buffer binding changed since the previous draw passed its draw time checks
+    vk::CmdBindIndexBuffer(m_commandBuffer->handle(), protected_index_buffer.handle(), 0, VK_INDEX_TYPE_UINT16);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDrawIndexed-commandBuffer-02707");
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), 1, 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
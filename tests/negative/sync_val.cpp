@@ -4846,6 +4846,54 @@ TEST_F(VkSyncValTest, SyncQSBufferCopyVsFence) {
     test.DeviceWait();
 }
 
+TEST_F(VkSyncValTest, SyncQSTrimmedAccessLog) {
+    TEST_DESCRIPTION("Check that hazards with accesses that outlive a trim of the submitted access logs are still reported.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device, m_device->m_queue_obj);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    vk_testing::Fence fence;
+    fence.init(*m_device, VkFenceObj::create_info());
+    VkBufferObj buffer_d;
+    test.InitBuffer(buffer_d);
+    VkCommandBufferObj cbd;
+    test.InitFromPool(cbd);
+    VkCommandBufferObj cbe;
+    test.InitFromPool(cbe);
+
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.RecordCopy(test.cbb, test.buffer_a, test.buffer_c);
+    test.RecordCopy(test.cbc, test.buffer_b, buffer_d);
+    // These write what the second and third command buffers wrote
+    test.RecordCopy(cbd, test.buffer_b, test.buffer_c);
+    test.RecordCopy(cbe, test.buffer_a, buffer_d);
+
+    // Waiting for the first submit trims its accesses and log, the later submits are trimmed as each is recorded
+    test.Submit0(test.cba, VK_NULL_HANDLE, 0U, VK_NULL_HANDLE, fence.handle());
+    const uint64_t kFourSeconds = 1U << 30;
+    if (fence.wait(kFourSeconds) != VK_SUCCESS) {
+        ADD_FAILURE() << "Fence wait failed. Aborting test.";
+        m_device->wait();
+    }
+    test.Submit0(test.cbb);
+    test.Submit0(test.cbc);
+
+    // Both hazards need the log entries of the accesses they conflict with
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(cbd);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(cbe);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
 TEST_F(VkSyncValTest, SyncQSBufferCopyQSORules) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
     ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
@@ -5298,3 +5346,85 @@ TEST_F(VkSyncValTest, SyncQSPresentAcquire) {
     present_image(acquired_index, &sem, nullptr);  // present without fence can't timeout
     m_device->wait();
 }
+
+TEST_F(VkSyncValTest, SyncFirstUseBufferHazardWithImageAccess) {
+    TEST_DESCRIPTION("Check that a buffer hazard is reported for executed or submitted commands that also access an image.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    VkImageObj image(m_device);
+    image.Init(VkImageObj::ImageCreateInfo2D(128, 128, 1, 1, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL));
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    VkImageSubresourceRange full_subresource_range{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkClearColorValue ccv = {};
+
+    // Unrelated to buffer_a, but gives the recorded commands more than one range to check for first use hazards
+    auto buffer_barrier = LvlInitStruct<VkBufferMemoryBarrier>();
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    buffer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.buffer = buffer_c.handle();
+    buffer_barrier.offset = 0;
+    buffer_barrier.size = 256;
+
+    // The buffer accesses are checked before the image accesses, so the buffer hazard must not be lost when the image is clean
+    VkCommandBufferObj secondary_cb1(m_device, m_commandPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    VkCommandBuffer scb1 = secondary_cb1.handle();
+    secondary_cb1.begin();
+    vk::CmdCopyBuffer(scb1, buffer_b.handle(), buffer_a.handle(), 1, &region);
+    vk::CmdClearColorImage(scb1, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &ccv, 1, &full_subresource_range);
+    secondary_cb1.end();
+
+    VkCommandBufferObj secondary_cb2(m_device, m_commandPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    VkCommandBuffer scb2 = secondary_cb2.handle();
+    secondary_cb2.begin();
+    secondary_cb2.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &buffer_barrier,
+                                  0, nullptr);
+    vk::CmdCopyBuffer(scb2, buffer_b.handle(), buffer_a.handle(), 1, &region);
+    vk::CmdClearColorImage(scb2, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &ccv, 1, &full_subresource_range);
+    secondary_cb2.end();
+
+    auto cb = m_commandBuffer->handle();
+    for (VkCommandBuffer scb : {scb1, scb2, scb2}) {
+        m_commandBuffer->reset();
+        m_commandBuffer->begin();
+        vk::CmdCopyBuffer(cb, buffer_c.handle(), buffer_a.handle(), 1, &region);
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+        vk::CmdExecuteCommands(cb, 1, &scb);
+        m_errorMonitor->VerifyFound();
+        m_commandBuffer->end();
+    }
+
+    // The same, with the commands in separate primary command buffers submitted together
+    m_commandBuffer->reset();
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(cb, buffer_c.handle(), buffer_a.handle(), 1, &region);
+    m_commandBuffer->end();
+
+    VkCommandBufferObj primary_cb(m_device, m_commandPool);
+    VkCommandBuffer pcb = primary_cb.handle();
+    primary_cb.begin();
+    primary_cb.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &buffer_barrier, 0,
+                               nullptr);
+    vk::CmdCopyBuffer(pcb, buffer_b.handle(), buffer_a.handle(), 1, &region);
+    vk::CmdClearColorImage(pcb, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &ccv, 1, &full_subresource_range);
+    primary_cb.end();
+
+    auto submit = LvlInitStruct<VkSubmitInfo>();
+    VkCommandBuffer two_cbs[2] = {cb, pcb};
+    submit.commandBufferCount = 2;
+    submit.pCommandBuffers = two_cbs;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    m_device->wait();
+}
@@ -1653,3 +1653,49 @@ TEST_F(VkPositiveLayerTest, UpdateDescritorSetsNoLongerInUse) {
         ASSERT_VK_SUCCESS(vk::QueueWaitIdle(m_device->m_queue));
     }
 }
+
+TEST_F(VkPositiveLayerTest, UpdateDescriptorSetWithTemplateConsecutiveBindings) {
+    TEST_DESCRIPTION("Update an array of tightly packed descriptors with a template, rolling over into the next binding");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 3, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+
+    auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_ci.size = 1024;
+    buffer_ci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    vk_testing::Buffer buffer(*m_device, buffer_ci, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    // Element 1 of binding 0 through element 1 of binding 1
+    VkDescriptorBufferInfo buffer_infos[4];
+    for (auto &buffer_info : buffer_infos) {
+        buffer_info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+    }
+
+    VkDescriptorUpdateTemplateEntry update_template_entry = {};
+    update_template_entry.dstBinding = 0;
+    update_template_entry.dstArrayElement = 1;
+    update_template_entry.descriptorCount = 4;
+    update_template_entry.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    update_template_entry.offset = 0;
+    update_template_entry.stride = sizeof(VkDescriptorBufferInfo);
+
+    auto update_template_ci = LvlInitStruct<VkDescriptorUpdateTemplateCreateInfo>();
+    update_template_ci.descriptorUpdateEntryCount = 1;
+    update_template_ci.pDescriptorUpdateEntries = &update_template_entry;
+    update_template_ci.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    update_template_ci.descriptorSetLayout = descriptor_set.layout_.handle();
+
+    VkDescriptorUpdateTemplate update_template = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateDescriptorUpdateTemplate(m_device->device(), &update_template_ci, nullptr, &update_template));
+    vk::UpdateDescriptorSetWithTemplate(m_device->device(), descriptor_set.set_, update_template, buffer_infos);
+    vk::DestroyDescriptorUpdateTemplate(m_device->device(), update_template, nullptr);
+}
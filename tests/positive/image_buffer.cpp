@@ -674,6 +674,80 @@ TEST_F(VkPositiveLayerTest, BindSparseFreeMemory) {
     vk::DestroyImage(m_device->device(), image, NULL);
 }
 
+TEST_F(VkPositiveLayerTest, BindSparseRebindPages) {
+    TEST_DESCRIPTION("Bind the pages of a sparse buffer to interleaved memory, rebind them to a single memory, then free the other");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    auto index = m_device->graphics_queue_node_index_;
+    if (!(m_device->queue_props[index].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT)) {
+        GTEST_SKIP() << "Graphics queue does not have sparse binding bit";
+    }
+    if (!m_device->phy().features().sparseBinding) {
+        GTEST_SKIP() << "Device does not support sparse bindings";
+    }
+
+    VkBufferCreateInfo buffer_create_info =
+        vk_testing::Buffer::create_info(1024 * 1024, VK_BUFFER_USAGE_TRANSFER_DST_BIT, nullptr);
+    buffer_create_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    VkBufferObj buffer;
+    buffer.init_no_mem(*m_device, buffer_create_info);
+
+    VkMemoryRequirements memory_reqs;
+    vk::GetBufferMemoryRequirements(m_device->device(), buffer.handle(), &memory_reqs);
+    const VkDeviceSize page_count = memory_reqs.size / memory_reqs.alignment;
+    if (page_count < 2) {
+        GTEST_SKIP() << "Buffer is not large enough to be bound in several pages";
+    }
+
+    VkMemoryAllocateInfo memory_info = LvlInitStruct<VkMemoryAllocateInfo>();
+    memory_info.allocationSize = memory_reqs.size;
+    bool pass = m_device->phy().set_memory_type(memory_reqs.memoryTypeBits, &memory_info, 0);
+    ASSERT_TRUE(pass);
+    vk_testing::DeviceMemory memory_one(*m_device, memory_info);
+    VkDeviceMemory memory_two = VK_NULL_HANDLE;
+    VkResult err = vk::AllocateMemory(m_device->device(), &memory_info, nullptr, &memory_two);
+    ASSERT_VK_SUCCESS(err);
+
+    // Bind every page one at a time, alternating between both memory objects
+    std::vector<VkSparseMemoryBind> binds(static_cast<size_t>(page_count));
+    for (VkDeviceSize page = 0; page < page_count; ++page) {
+        VkSparseMemoryBind &bind = binds[static_cast<size_t>(page)];
+        bind.flags = 0;
+        bind.memory = (page % 2) ? memory_two : memory_one.handle();
+        bind.memoryOffset = page * memory_reqs.alignment;
+        bind.resourceOffset = page * memory_reqs.alignment;
+        bind.size = memory_reqs.alignment;
+    }
+    binds.back().size = memory_reqs.size - binds.back().resourceOffset;
+
+    VkSparseBufferMemoryBindInfo buffer_bind_info;
+    buffer_bind_info.buffer = buffer.handle();
+    buffer_bind_info.bindCount = static_cast<uint32_t>(binds.size());
+    buffer_bind_info.pBinds = binds.data();
+
+    VkBindSparseInfo bind_sparse_info = LvlInitStruct<VkBindSparseInfo>();
+    bind_sparse_info.bufferBindCount = 1;
+    bind_sparse_info.pBufferBinds = &buffer_bind_info;
+    vk::QueueBindSparse(m_device->m_queue, 1, &bind_sparse_info, VK_NULL_HANDLE);
+
+    // Rebind the pages backed by the second memory to the first one, the buffer no longer references memory_two afterwards
+    for (auto &bind : binds) {
+        bind.memory = memory_one.handle();
+    }
+    vk::QueueBindSparse(m_device->m_queue, 1, &bind_sparse_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+
+    m_commandBuffer->begin();
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_commandBuffer->end();
+
+    // Freeing memory that is no longer bound must not invalidate the command buffer using the buffer
+    vk::FreeMemory(m_device->device(), memory_two, nullptr);
+    m_commandBuffer->QueueCommandBuffer();
+    vk::QueueWaitIdle(m_device->m_queue);
+}
+
 TEST_F(VkPositiveLayerTest, BindSparseMetadata) {
     TEST_DESCRIPTION("Bind memory for the metadata aspect of a sparse image");
 
@@ -920,6 +994,112 @@ TEST_F(VkPositiveLayerTest, ClearDepthStencilWithValidRange) {
     }
 }
 
+TEST_F(VkPositiveLayerTest, SubresourceRangeLayoutTracking) {
+    TEST_DESCRIPTION("Transition subresource ranges that are and aren't one contiguous index range, and check tracked layouts");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    m_commandBuffer->begin();
+    const auto cb_handle = m_commandBuffer->handle();
+
+    const auto transition = [cb_handle](VkImage image, const VkImageSubresourceRange &range, VkImageLayout old_layout,
+                                        VkImageLayout new_layout) {
+        auto barrier = LvlInitStruct<VkImageMemoryBarrier>();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = range;
+        vk::CmdPipelineBarrier(cb_handle, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                               1, &barrier);
+    };
+
+    // Color image with several mips and layers
+    {
+        const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        auto image_ci = VkImageObj::ImageCreateInfo2D(32, 32, 4, 6, VK_FORMAT_R8G8B8A8_UNORM, usage, VK_IMAGE_TILING_OPTIMAL);
+        VkImageObj image(m_device);
+        image.Init(image_ci);
+        ASSERT_TRUE(image.initialized());
+
+        const VkClearColorValue clear_color = {{0.0f, 0.0f, 0.0f, 1.0f}};
+        const VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+        const VkImageSubresourceRange whole = {aspect, 0, 4, 0, 6};
+        const VkImageSubresourceRange mip_0 = {aspect, 0, 1, 0, 6};
+        const VkImageSubresourceRange mip_1 = {aspect, 1, 1, 0, 6};
+        const VkImageSubresourceRange mips_1_3 = {aspect, 1, 3, 0, 6};
+        const VkImageSubresourceRange mips_2_3 = {aspect, 2, 2, 0, 6};
+
+        // The whole image
+        transition(image.handle(), whole, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &whole);
+
+        // A single mip level with all layers
+        transition(image.handle(), mip_1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &mip_1);
+        {
+            const VkImageSubresourceRange others[2] = {mip_0, mips_2_3};
+            vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 2, others);
+        }
+
+        // A run of mip levels with all layers
+        transition(image.handle(), mips_2_3, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &mips_1_3);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &mip_0);
+        transition(image.handle(), mips_1_3, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &whole);
+
+        // A subset of the layers of more than one mip level isn't a single index range
+        const VkImageSubresourceRange layer_subset = {aspect, 0, 2, 2, 2};
+        transition(image.handle(), layer_subset, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &layer_subset);
+        {
+            const VkImageSubresourceRange others[3] = {{aspect, 0, 2, 0, 2}, {aspect, 0, 2, 4, 2}, mips_2_3};
+            vk::CmdClearColorImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 3, others);
+        }
+    }
+
+    // Depth/stencil image, where each aspect is a separate part of the index space
+    {
+        const VkFormat depth_format = FindSupportedDepthStencilFormat(gpu());
+        auto image_ci =
+            VkImageObj::ImageCreateInfo2D(32, 32, 2, 2, depth_format, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL);
+        VkImageObj image(m_device);
+        image.Init(image_ci);
+        ASSERT_TRUE(image.initialized());
+
+        const VkClearDepthStencilValue clear_value = {};
+        const VkImageAspectFlags aspect = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        const VkImageSubresourceRange whole = {aspect, 0, 2, 0, 2};
+        const VkImageSubresourceRange mip_0 = {aspect, 0, 1, 0, 2};
+        const VkImageSubresourceRange mip_1 = {aspect, 1, 1, 0, 2};
+
+        // Both aspects of the whole image
+        transition(image.handle(), whole, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vk::CmdClearDepthStencilImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_value, 1, &whole);
+
+        // Both aspects of one mip level span two index ranges
+        transition(image.handle(), mip_1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        vk::CmdClearDepthStencilImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_value, 1, &mip_1);
+        vk::CmdClearDepthStencilImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_value, 1, &mip_0);
+
+        // As do both aspects of one layer
+        const VkImageSubresourceRange layer_1 = {aspect, 0, 2, 1, 1};
+        transition(image.handle(), mip_0, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        transition(image.handle(), layer_1, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vk::CmdClearDepthStencilImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_value, 1, &layer_1);
+        {
+            const VkImageSubresourceRange layer_0 = {aspect, 0, 2, 0, 1};
+            vk::CmdClearDepthStencilImage(cb_handle, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_value, 1, &layer_0);
+        }
+    }
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkPositiveLayerTest, ExternalMemory) {
     TEST_DESCRIPTION("Perform a copy through a pair of buffers linked by external memory");
 
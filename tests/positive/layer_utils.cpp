@@ -106,4 +106,38 @@ TEST_F(VkPositiveLayerTest, IsValidPlaneAspect) {
     ASSERT_TRUE(IsValidPlaneAspect(two_plane_format, VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT));
     ASSERT_FALSE(IsValidPlaneAspect(two_plane_format, VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT));
     ASSERT_FALSE(IsValidPlaneAspect(two_plane_format, VK_IMAGE_ASPECT_PLANE_2_BIT));
-}
\ No newline at end of file
+}
+
+TEST_F(VkPositiveLayerTest, FormatUtilsLookup) {
+    TEST_DESCRIPTION("Format helpers for core, extension and unknown formats");
+
+    // core format
+    ASSERT_TRUE(FormatIsUNORM(VK_FORMAT_R8G8B8A8_UNORM));
+    ASSERT_TRUE(FormatElementSize(VK_FORMAT_R8G8B8A8_UNORM) == 4);
+    ASSERT_TRUE(FormatIsDepthAndStencil(VK_FORMAT_D24_UNORM_S8_UINT));
+    ASSERT_TRUE(FormatDepthSize(VK_FORMAT_D24_UNORM_S8_UINT) == 24);
+    ASSERT_TRUE(FormatStencilNumericalType(VK_FORMAT_D24_UNORM_S8_UINT) == FORMAT_NUMERICAL_TYPE::UINT);
+    ASSERT_FALSE(FormatIsUNORM(VK_FORMAT_D24_UNORM_S8_UINT));
+    ASSERT_TRUE(FormatIsCompressed_BC(VK_FORMAT_BC7_SRGB_BLOCK));
+
+    // extension formats
+    ASSERT_TRUE(FormatIsCompressed_PVRTC(VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG));
+    ASSERT_TRUE(FormatIsCompressed_ASTC_HDR(VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK));
+    ASSERT_TRUE(FormatPlaneCount(VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM) == 3);
+    ASSERT_TRUE(FormatIsYChromaSubsampled(VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM));
+    ASSERT_TRUE(FormatIsSinglePlane_422(VK_FORMAT_G8B8G8R8_422_UNORM));
+    ASSERT_TRUE(FormatIsPacked(VK_FORMAT_A4R4G4B4_UNORM_PACK16));
+    ASSERT_TRUE(FormatCompatibilityClass(VK_FORMAT_R16G16_S10_5_NV) == FORMAT_COMPATIBILITY_CLASS::_32BIT);
+
+    // unknown formats
+    for (const VkFormat format : {VK_FORMAT_UNDEFINED, static_cast<VkFormat>(1000156999), VK_FORMAT_MAX_ENUM}) {
+        ASSERT_FALSE(FormatIsUNORM(format));
+        ASSERT_FALSE(FormatIsCompressed(format));
+        ASSERT_FALSE(FormatIsDepthOrStencil(format));
+        ASSERT_TRUE(FormatPlaneCount(format) == 1);
+        ASSERT_TRUE(FormatElementSize(format) == 0);
+        ASSERT_TRUE(FormatCompatibilityClass(format) == FORMAT_COMPATIBILITY_CLASS::NONE);
+    }
+    const VkExtent3D unknown_extent = FormatTexelBlockExtent(VK_FORMAT_MAX_ENUM);
+    ASSERT_TRUE(unknown_extent.width == 1 && unknown_extent.height == 1 && unknown_extent.depth == 1);
+}
@@ -3212,3 +3212,77 @@ TEST_F(VkPositiveLayerTest, UnnormalizedCoordinatesNotSampled) {
     m_commandBuffer->EndRenderPass();
     m_commandBuffer->end();
 }
+
+TEST_F(VkPositiveLayerTest, ShaderModuleIdenticalSpirvFirstDestroyed) {
+    TEST_DESCRIPTION("Create two modules from identical SPIR-V, destroy the first, then create and use a pipeline with the second");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x = 1) in;
+        layout(set = 0, binding = 0) buffer SSBO { uint x; } ssbo;
+        void main() { ssbo.x = 1; }
+    )glsl";
+
+    // Group decorations are flattened at module creation, so these modules don't share their SPIR-V
+    const char *cs_group_decoration_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %group DescriptorSet 0
+               OpDecorate %ssbo Binding 0
+               OpDecorate %struct BufferBlock
+               OpMemberDecorate %struct 0 Offset 0
+      %group = OpDecorationGroup
+               OpGroupDecorate %group %ssbo
+       %void = OpTypeVoid
+       %func = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+     %uint_1 = OpConstant %uint 1
+     %struct = OpTypeStruct %uint
+ %ptr_struct = OpTypePointer Uniform %struct
+   %ptr_uint = OpTypePointer Uniform %uint
+       %ssbo = OpVariable %ptr_struct Uniform
+       %main = OpFunction %void None %func
+      %label = OpLabel
+          %x = OpAccessChain %ptr_uint %ssbo %int_0
+               OpStore %x %uint_1
+               OpReturn
+               OpFunctionEnd
+    )";
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, VkBufferObj::create_info(1024, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+
+    const auto create_shader = [this](const char *source, SpvSourceType source_type) {
+        return new VkShaderObj(this, source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, source_type);
+    };
+    const std::pair<const char *, SpvSourceType> sources[] = {{cs_source, SPV_SOURCE_GLSL},
+                                                              {cs_group_decoration_source, SPV_SOURCE_ASM}};
+    for (const auto &source : sources) {
+        std::unique_ptr<VkShaderObj> first_module(create_shader(source.first, source.second));
+
+        CreateComputePipelineHelper pipe(*this);
+        pipe.InitInfo();
+        pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+        pipe.cs_.reset(create_shader(source.first, source.second));
+        first_module.reset();
+        pipe.InitState();
+        ASSERT_VK_SUCCESS(pipe.CreateComputePipeline());
+
+        pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, 1024, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        pipe.descriptor_set_->UpdateDescriptorSets();
+
+        m_commandBuffer->begin();
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &pipe.descriptor_set_->set_, 0, nullptr);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+        m_commandBuffer->end();
+        m_commandBuffer->QueueCommandBuffer();
+        m_device->wait();
+    }
+}
@@ -120,3 +120,51 @@ TEST_F(VkPositiveSyncValTest, SyncCmdClearAttachmentLayer) {
     m_commandBuffer->QueueCommandBuffer();
     vk::QueueWaitIdle(m_device->m_queue);
 }
+
+TEST_F(VkPositiveSyncValTest, SyncSecondaryWithBarrierExecutedFromTwoPrimaries) {
+    TEST_DESCRIPTION("Execute the same secondary command buffer, whose barrier protects its accesses, from two primaries.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    auto mem_barrier = LvlInitStruct<VkMemoryBarrier>();
+    mem_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    mem_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    // Not one time submit, as it is submitted with each of the primaries
+    auto inheritance_info = LvlInitStruct<VkCommandBufferInheritanceInfo>();
+    auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    begin_info.pInheritanceInfo = &inheritance_info;
+
+    VkCommandBufferObj secondary_cb(m_device, m_commandPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    VkCommandBuffer scb = secondary_cb.handle();
+    secondary_cb.begin(&begin_info);
+    secondary_cb.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &mem_barrier, 0, nullptr, 0,
+                                 nullptr);
+    vk::CmdCopyBuffer(scb, buffer_c.handle(), buffer_a.handle(), 1, &region);
+    secondary_cb.end();
+
+    // The barrier orders the copy into buffer_a after the first primary's write, and after the second primary's read
+    auto cb = m_commandBuffer->handle();
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(cb, buffer_b.handle(), buffer_a.handle(), 1, &region);
+    vk::CmdExecuteCommands(cb, 1, &scb);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+
+    VkCommandBufferObj primary_cb(m_device, m_commandPool);
+    VkCommandBuffer pcb = primary_cb.handle();
+    primary_cb.begin();
+    vk::CmdCopyBuffer(pcb, buffer_a.handle(), buffer_b.handle(), 1, &region);
+    vk::CmdExecuteCommands(pcb, 1, &scb);
+    primary_cb.end();
+    primary_cb.QueueCommandBuffer();
+}